@@ -57,7 +57,15 @@ public class AssetsBridge : ModuleRules
 				"DatasmithTranslator",
 				"DatasmithContent",
 				"AssetTools",
-				"AssetRegistry"
+				"AssetRegistry",
+				"MeshDescription",
+				"SkeletalMeshDescription",
+				"SkeletalMeshUtilitiesCommon",
+				"InterchangeCore",
+				"InterchangeEngine",
+				"InterchangeNodes",
+				"InterchangeFactoryNodes",
+				"InterchangePipelines"
 				// ... add private dependencies that you statically link with here ...
 			}
 		);
@@ -8,4 +8,17 @@
 UABSettings::UABSettings(const FObjectInitializer& obj)
 {
 	AssetLocationOnDisk = TEXT("");
+	ManifestFormat = EBridgeManifestFormat::Json;
+	bVerboseLogging = false;
+	ParallelExportWorkers = 0;
+	bSkipUnchangedExports = true;
+	bBatchImport = true;
+	ImportBatchSize = 64;
+	bAsyncImport = false;
+	bSkipUnchangedImports = true;
+	bDeduplicateTextures = true;
+	SharedTextureFolder = TEXT("/Game/AssetsBridge/Textures/Shared");
+	bFastSkeletonRetarget = true;
+	bPruneMorphTargets = true;
+	MorphTargetPruneThreshold = 0.01f;
 }
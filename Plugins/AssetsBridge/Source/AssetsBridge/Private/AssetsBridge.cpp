@@ -7,6 +7,7 @@
 #include "AssetsBridgeCommands.h"
 #include "AssetsBridgeTools.h"
 #include "BridgeManager.h"
+#include "BridgeSkeletonIndex.h"
 #include "EditorAssetLibrary.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Layout/SBox.h"
@@ -18,6 +19,8 @@
 #include "Logging/LogMacros.h"
 
 
+DEFINE_LOG_CATEGORY(LogAssetsBridge);
+
 static const FName AssetsBridgeTabName("Assets Bridge Configuration");
 
 #define LOCTEXT_NAMESPACE "FAssetsBridgeModule"
@@ -29,6 +32,9 @@ void FAssetsBridgeModule::StartupModule()
 	FAssetsBridgeStyle::Initialize();
 	FAssetsBridgeStyle::ReloadTextures();
 
+	UBridgeSkeletonIndex::RegisterAssetRegistryTags();
+	UBridgeManager::RegisterAssetRegistryTags();
+
 	FAssetsBridgeCommands::Register();
 
 	PluginCommands = MakeShareable(new FUICommandList);
@@ -193,7 +199,7 @@ void FAssetsBridgeModule::MakeAssetButtonClicked()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Invalid asset detected"))
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Invalid asset detected"))
 		}
 	}
 	if (!bIsSuccessful)
@@ -254,7 +260,15 @@ void FAssetsBridgeModule::ImportButtonClicked()
 	}
 	bool Success = false;
 	FString OutMessage;
-	UBridgeManager::GenerateImport(Success, OutMessage);
+	if (GetDefault<UABSettings>()->bAsyncImport)
+	{
+		// Progress and the final result are reported through the import notification
+		UBridgeManager::GenerateImportAsync(FBridgeImportOptions(), FOnBridgeImportComplete(), Success, OutMessage);
+	}
+	else
+	{
+		UBridgeManager::GenerateImport(Success, OutMessage);
+	}
 	if (!Success)
 	{
 		FText DialogText = FText::FromString(OutMessage);
@@ -0,0 +1,371 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "AssetsBridgeBenchmarkCommandlet.h"
+
+#include "ABSettings.h"
+#include "AssetsBridge.h"
+#include "BridgeManager.h"
+#include "BridgeManifest.h"
+#include "EditorAssetLibrary.h"
+#include "JsonObjectConverter.h"
+#include "PBRMaterialBuilder.h"
+#include "Animation/Skeleton.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/SkeletalMesh.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Interfaces/ITargetPlatformManagerModule.h"
+#include "LODUtilities.h"
+#include "Misc/FileHelper.h"
+
+/** Returns the asset a successful import result points at. */
+static UObject* LoadImportedAsset(const FBridgeImportItemResult& Result)
+{
+	if (!Result.bIsSuccessful || Result.PackageName.IsEmpty())
+	{
+		return nullptr;
+	}
+	const FString ObjectPath = Result.PackageName + TEXT(".") + FPackageName::GetShortName(Result.PackageName);
+	return LoadObject<UObject>(nullptr, *ObjectPath);
+}
+
+/** Appends the samples of a report to a CSV with one row per run and stage, "Total" being the whole run. */
+static FString BenchmarkReportToCsv(const FBridgeBenchmarkReport& Report)
+{
+	FString Csv = TEXT("case,iteration,items,success,stage,count,seconds,used_physical_mb,peak_used_physical_mb\n");
+	for (const FBridgeBenchmarkSample& Sample : Report.Samples)
+	{
+		Csv += FString::Printf(TEXT("\"%s\",%d,%d,%d,\"Total\",1,%.6f,%.1f,%.1f\n"), *Sample.Case, Sample.Iteration, Sample.Items,
+		                       Sample.bIsSuccessful ? 1 : 0, Sample.Seconds, Sample.UsedPhysicalMB, Sample.PeakUsedPhysicalMB);
+		for (const FBridgeStageStats& Stage : Sample.Stages)
+		{
+			Csv += FString::Printf(TEXT("\"%s\",%d,%d,%d,\"%s\",%d,%.6f,,\n"), *Sample.Case, Sample.Iteration, Sample.Items,
+			                       Sample.bIsSuccessful ? 1 : 0, *Stage.Stage, Stage.Count, Stage.Seconds);
+		}
+	}
+	return Csv;
+}
+
+UAssetsBridgeBenchmarkCommandlet::UAssetsBridgeBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAssetsBridgeBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString FixtureFile;
+	if (!FParse::Value(*Params, TEXT("Fixture="), FixtureFile))
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("Usage: -run=AssetsBridgeBenchmark -Fixture=<manifest> [-Cases=Manifest,Import,Retarget,RetargetFull,Export,Material] [-Iterations=<n>] [-ManifestItems=<n>] [-LODs=<n>] [-Report=<file>]"));
+		return 2;
+	}
+	FString CaseList = TEXT("Manifest,Import,Retarget,RetargetFull,Export,Material");
+	FParse::Value(*Params, TEXT("Cases="), CaseList, false);
+	TArray<FString> Cases;
+	CaseList.ParseIntoArray(Cases, TEXT(","));
+	int32 Iterations = 3;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(1, Iterations);
+	int32 RetargetLODs = 1;
+	FParse::Value(*Params, TEXT("LODs="), RetargetLODs);
+	RetargetLODs = FMath::Clamp(RetargetLODs, 1, MAX_SKELETAL_MESH_LODS);
+	int32 ManifestItems = 10000;
+	FParse::Value(*Params, TEXT("ManifestItems="), ManifestItems);
+	ManifestItems = FMath::Max(1, ManifestItems);
+
+	const FString WorkDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AssetsBridge"), TEXT("Benchmarks"));
+	FString ReportBase;
+	if (!FParse::Value(*Params, TEXT("Report="), ReportBase))
+	{
+		ReportBase = FPaths::Combine(WorkDir, FString::Printf(TEXT("benchmark-%s"), *FDateTime::UtcNow().ToString()));
+	}
+	ReportBase = FPaths::Combine(FPaths::GetPath(ReportBase), FPaths::GetBaseFilename(ReportBase));
+	IFileManager::Get().MakeDirectory(*WorkDir, true);
+
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	const FBridgeExport Fixture = UAssetsBridgeTools::ReadBridgeExportFileAt(FixtureFile, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful || Fixture.Objects.Num() == 0)
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("Unusable fixture %s: %s"), *FixtureFile, *OutMessage);
+		return 2;
+	}
+
+	FBridgeBenchmarkReport Report;
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AssetsBridge"));
+	Report.PluginVersion = Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString();
+	Report.Platform = FPlatformProperties::IniPlatformName();
+	Report.Timestamp = FDateTime::UtcNow().ToIso8601();
+	Report.Fixture = FixtureFile;
+
+	// Every run is one bridge operation, so the stage timings of the pipeline land in the sample.
+	// Setup runs untimed before each iteration and may update Items.
+	bool bAllSuccessful = true;
+	auto RunCase = [&Report, &bAllSuccessful, Iterations](const FString& Case, const int32& Items, TFunctionRef<bool()> Body,
+	                                                      TFunction<void()> Setup = nullptr)
+	{
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			if (Setup)
+			{
+				Setup();
+			}
+			FBridgeBenchmarkSample Sample;
+			Sample.Case = Case;
+			Sample.Iteration = Iteration;
+			Sample.Items = Items;
+			FBridgeStats::BeginOperation(Case);
+			const double StartTime = FPlatformTime::Seconds();
+			Sample.bIsSuccessful = Body();
+			Sample.Seconds = FPlatformTime::Seconds() - StartTime;
+			FBridgeStats::EndOperation();
+			Sample.Stages = FBridgeStats::GetLastOperation().Stages;
+			const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+			Sample.UsedPhysicalMB = MemoryStats.UsedPhysical / (1024.0 * 1024.0);
+			Sample.PeakUsedPhysicalMB = MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0);
+			bAllSuccessful &= Sample.bIsSuccessful;
+			UE_LOG(LogAssetsBridge, Display, TEXT("%s #%d: %d item(s) in %.3fs%s"), *Case, Iteration, Items, Sample.Seconds,
+			       Sample.bIsSuccessful ? TEXT("") : TEXT(" (failed)"));
+			Report.Samples.Add(MoveTemp(Sample));
+		}
+	};
+
+	// Process-only overrides: the cases must do real work on every iteration
+	UABSettings* Settings = GetMutableDefault<UABSettings>();
+	Settings->bSkipUnchangedExports = false;
+	const EBridgeManifestFormat ConfiguredFormat = Settings->ManifestFormat;
+
+	if (Cases.Contains(TEXT("Manifest")))
+	{
+		FBridgeExport Manifest;
+		Manifest.Operation = Fixture.Operation;
+		for (int32 Idx = 0; Idx < ManifestItems; Idx++)
+		{
+			FExportAsset Item = Fixture.Objects[Idx % Fixture.Objects.Num()];
+			Item.ObjectID += FString::Printf(TEXT("-%d"), Idx);
+			Manifest.Objects.Add(MoveTemp(Item));
+		}
+		// Different base names, otherwise reading one file would resolve to its newer other-format sibling
+		const FString JsonFile = FPaths::Combine(WorkDir, TEXT("benchmark-manifest.json"));
+		const FString BinaryFile = FPaths::Combine(WorkDir, TEXT("benchmark-manifest-binary.abmf"));
+
+		RunCase(TEXT("Manifest Write (Json)"), ManifestItems, [&]()
+		{
+			Settings->ManifestFormat = EBridgeManifestFormat::Json;
+			UAssetsBridgeTools::WriteBridgeExportFileAt(Manifest, JsonFile, bIsSuccessful, OutMessage);
+			return bIsSuccessful;
+		});
+		RunCase(TEXT("Manifest Write (Binary)"), ManifestItems, [&]()
+		{
+			Settings->ManifestFormat = EBridgeManifestFormat::Binary;
+			UAssetsBridgeTools::WriteBridgeExportFileAt(Manifest, BinaryFile, bIsSuccessful, OutMessage);
+			return bIsSuccessful;
+		});
+		Settings->ManifestFormat = ConfiguredFormat;
+
+		RunCase(TEXT("Manifest Parse (Json Object)"), ManifestItems, [&]()
+		{
+			BRIDGE_STAGE_SCOPE("Manifest Read");
+			FBridgeExport Parsed;
+			const TSharedPtr<FJsonObject> JsonObject = UAssetsBridgeTools::ReadJson(JsonFile, bIsSuccessful, OutMessage);
+			return bIsSuccessful && FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), &Parsed)
+				&& Parsed.Objects.Num() == ManifestItems;
+		});
+		RunCase(TEXT("Manifest Parse (Streaming)"), ManifestItems, [&]()
+		{
+			const FBridgeExport Parsed = UAssetsBridgeTools::ReadBridgeExportFileAt(JsonFile, bIsSuccessful, OutMessage);
+			return bIsSuccessful && Parsed.Objects.Num() == ManifestItems;
+		});
+		RunCase(TEXT("Manifest Parse (Binary)"), ManifestItems, [&]()
+		{
+			const FBridgeExport Parsed = UAssetsBridgeTools::ReadBridgeExportFileAt(BinaryFile, bIsSuccessful, OutMessage);
+			return bIsSuccessful && Parsed.Objects.Num() == ManifestItems;
+		});
+		IFileManager::Get().Delete(*JsonFile);
+		IFileManager::Get().Delete(*BinaryFile);
+	}
+
+	// Export works on the imported meshes, so it also needs the import case
+	TArray<FBridgeImportItemResult> ImportResults;
+	const bool bNeedsImport = Cases.Contains(TEXT("Import")) || Cases.Contains(TEXT("Export"));
+	if (bNeedsImport)
+	{
+		FBridgeImportOptions Options;
+		Options.ManifestPath = FixtureFile;
+		Options.bForceReimport = true;
+		const int32 NumFixtureItems = Fixture.Objects.Num();
+		RunCase(TEXT("Import"), NumFixtureItems, [&]()
+		{
+			UBridgeManager::GenerateImportWithResults(Options, ImportResults, bIsSuccessful, OutMessage);
+			return bIsSuccessful;
+		});
+	}
+
+	// The skeletal fixture items that name a skeleton are retargeted to it
+	TArray<const FExportAsset*> RetargetItems;
+	if (Cases.Contains(TEXT("Retarget")) || Cases.Contains(TEXT("RetargetFull")))
+	{
+		bool bSkeletonsLoaded = true;
+		for (const FExportAsset& Item : Fixture.Objects)
+		{
+			if (Item.StringType.Equals(TEXT("SkeletalMesh"), ESearchCase::IgnoreCase) && !Item.Skeleton.IsEmpty())
+			{
+				RetargetItems.Add(&Item);
+				bSkeletonsLoaded &= LoadObject<USkeleton>(nullptr, *Item.Skeleton) != nullptr;
+			}
+		}
+		// A corpus without -Skeleton refers to the skeleton its first mesh generates, which only an import creates
+		if (!bSkeletonsLoaded && !bNeedsImport)
+		{
+			FBridgeImportOptions Options;
+			Options.ManifestPath = FixtureFile;
+			UBridgeManager::GenerateImportWithResults(Options, ImportResults, bIsSuccessful, OutMessage);
+		}
+	}
+
+	const FString RetargetContentDir = TEXT("/Game/AssetsBridgeBenchmark/Retarget");
+	const bool bConfiguredFastRetarget = Settings->bFastSkeletonRetarget;
+	for (const bool bFastRetarget : {true, false})
+	{
+		const TCHAR* RetargetCase = bFastRetarget ? TEXT("Retarget") : TEXT("RetargetFull");
+		if (!Cases.Contains(RetargetCase))
+		{
+			continue;
+		}
+		Settings->bFastSkeletonRetarget = bFastRetarget;
+
+		// A retarget consumes the generated skeleton, so every iteration starts from a fresh, untimed import.
+		// The bridge import would point the meshes at their manifest skeleton and generate none, so the items
+		// are imported on their own, without a skeleton, into a scratch folder that holds no earlier mesh
+		TArray<FSkeletonImportResult> Retargets;
+		int32 NumRetargets = 0;
+		RunCase(RetargetCase, NumRetargets, [&]()
+		{
+			if (Retargets.Num() == 0)
+			{
+				return true;
+			}
+			UBridgeManager::RetargetSkeletalMeshesToSkeleton(Retargets, true, bIsSuccessful, OutMessage);
+			return bIsSuccessful;
+		}, [&]()
+		{
+			UEditorAssetLibrary::DeleteDirectory(RetargetContentDir);
+			Retargets.Reset();
+			for (int32 Idx = 0; Idx < RetargetItems.Num(); Idx++)
+			{
+				const FExportAsset& Item = *RetargetItems[Idx];
+				const FString DestPath = RetargetContentDir / FString::Printf(TEXT("%s_%d"), *Item.ShortName, Idx);
+				USkeletalMesh* Mesh = Cast<USkeletalMesh>(UBridgeManager::ImportAsset(Item.ExportLocation, DestPath, Item.StringType,
+				                                                                       FString(), bIsSuccessful, OutMessage));
+				if (!Mesh)
+				{
+					UE_LOG(LogAssetsBridge, Warning, TEXT("Could not import %s for the retarget: %s"), *Item.ExportLocation, *OutMessage);
+					continue;
+				}
+				// glTF carries a single LOD; the others are reduced from it, like the LOD chain of a game character
+				if (RetargetLODs > 1)
+				{
+					FLODUtilities::RegenerateLOD(Mesh, GetTargetPlatformManagerRef().GetRunningTargetPlatform(), RetargetLODs);
+				}
+				FSkeletonImportResult Analysis = UBridgeManager::AnalyzeSkeletalMeshImport(Mesh, Item.Skeleton);
+				if (Analysis.bNewSkeletonGenerated)
+				{
+					Retargets.Add(MoveTemp(Analysis));
+				}
+			}
+			NumRetargets = Retargets.Num();
+		});
+		Settings->bFastSkeletonRetarget = bConfiguredFastRetarget;
+	}
+	if (RetargetItems.Num() > 0)
+	{
+		UEditorAssetLibrary::DeleteDirectory(RetargetContentDir);
+	}
+
+	// Median per-mesh time of both retarget paths side by side, the number to quote for a large character
+	auto MedianSecondsPerItem = [&Report](const TCHAR* Case)
+	{
+		TArray<double> Seconds;
+		for (const FBridgeBenchmarkSample& Sample : Report.Samples)
+		{
+			if (Sample.Case == Case && Sample.bIsSuccessful && Sample.Items > 0)
+			{
+				Seconds.Add(Sample.Seconds / Sample.Items);
+			}
+		}
+		Seconds.Sort();
+		return Seconds.Num() > 0 ? Seconds[Seconds.Num() / 2] : 0.0;
+	};
+	const double FastSeconds = MedianSecondsPerItem(TEXT("Retarget"));
+	const double FullSeconds = MedianSecondsPerItem(TEXT("RetargetFull"));
+	if (FastSeconds > 0.0 && FullSeconds > 0.0)
+	{
+		UE_LOG(LogAssetsBridge, Display, TEXT("Retarget per mesh (median): fast %.1fms, full %.1fms, %.1fx"), FastSeconds * 1000.0,
+		       FullSeconds * 1000.0, FullSeconds / FastSeconds);
+	}
+
+	if (Cases.Contains(TEXT("Export")))
+	{
+		// Export into the work directory rather than the user's bridge folder
+		Settings->AssetLocationOnDisk = FPaths::Combine(WorkDir, TEXT("Export"));
+		TArray<FExportAsset> ExportItems;
+		for (const FBridgeImportItemResult& Result : ImportResults)
+		{
+			if (UObject* Asset = LoadImportedAsset(Result))
+			{
+				FExportAsset Item = UAssetsBridgeTools::GetExportInfo(FAssetData(Asset), bIsSuccessful, OutMessage);
+				if (bIsSuccessful)
+				{
+					ExportItems.Add(MoveTemp(Item));
+				}
+			}
+		}
+		const int32 NumExportItems = ExportItems.Num();
+		RunCase(TEXT("Export"), NumExportItems, [&]()
+		{
+			UBridgeManager::GenerateExport(ExportItems, bIsSuccessful, OutMessage);
+			return bIsSuccessful;
+		});
+		IFileManager::Get().DeleteDirectory(*Settings->AssetLocationOnDisk, false, true);
+	}
+
+	if (Cases.Contains(TEXT("Material")))
+	{
+		TArray<const FExportAsset*> TexturedItems;
+		for (const FExportAsset& Item : Fixture.Objects)
+		{
+			if (Item.HasTextures())
+			{
+				TexturedItems.Add(&Item);
+			}
+		}
+		const int32 NumTexturedItems = TexturedItems.Num();
+		RunCase(TEXT("Material"), NumTexturedItems, [&]()
+		{
+			bool bBuildSuccessful = true;
+			for (const FExportAsset* Item : TexturedItems)
+			{
+				const FString ContentDir = FPaths::Combine(TEXT("/Game"), Item->InternalPath);
+				FString BuildMessage;
+				bBuildSuccessful &= UPBRMaterialBuilder::BuildMaterialInstance(Item->Textures, Item->ShortName, ContentDir / TEXT("Textures"),
+				                                                               FString(), BuildMessage) != nullptr;
+			}
+			return bBuildSuccessful;
+		});
+	}
+
+	FString Json;
+	FJsonObjectConverter::UStructToJsonObjectString(Report, Json);
+	const bool bJsonWritten = FFileHelper::SaveStringToFile(Json, *(ReportBase + TEXT(".json")));
+	const bool bCsvWritten = FFileHelper::SaveStringToFile(BenchmarkReportToCsv(Report), *(ReportBase + TEXT(".csv")));
+	if (!bJsonWritten || !bCsvWritten)
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("Could not write the benchmark report to %s"), *ReportBase);
+		return 2;
+	}
+	UE_LOG(LogAssetsBridge, Display, TEXT("Benchmark report written to %s.json/.csv"), *ReportBase);
+	return bAllSuccessful ? 0 : 1;
+}
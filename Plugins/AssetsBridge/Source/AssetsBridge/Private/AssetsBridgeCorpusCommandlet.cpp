@@ -0,0 +1,51 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "AssetsBridgeCorpusCommandlet.h"
+
+#include "AssetsBridge.h"
+#include "BridgeCorpusGenerator.h"
+
+UAssetsBridgeCorpusCommandlet::UAssetsBridgeCorpusCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAssetsBridgeCorpusCommandlet::Main(const FString& Params)
+{
+	FBridgeCorpusOptions Options;
+	if (!FParse::Value(*Params, TEXT("Output="), Options.OutputDir))
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("Usage: -run=AssetsBridgeCorpus -Output=<dir> [-Seed=<n>] [-StaticMeshes=<n>] [-SkeletalMeshes=<n>] [-Triangles=<n>] [-Bones=<n>] [-Morphs=<n>] [-MaterialSlots=<n>] [-TextureSets=<n>] [-TextureSize=<n>] [-ContentPath=/Game/<dir>] [-Skeleton=<path>]"));
+		return 1;
+	}
+	FParse::Value(*Params, TEXT("Seed="), Options.Seed);
+	FParse::Value(*Params, TEXT("StaticMeshes="), Options.StaticMeshes);
+	FParse::Value(*Params, TEXT("SkeletalMeshes="), Options.SkeletalMeshes);
+	FParse::Value(*Params, TEXT("Triangles="), Options.Triangles);
+	FParse::Value(*Params, TEXT("Bones="), Options.Bones);
+	FParse::Value(*Params, TEXT("Morphs="), Options.MorphTargets);
+	FParse::Value(*Params, TEXT("MaterialSlots="), Options.MaxMaterialSlots);
+	FParse::Value(*Params, TEXT("TextureSets="), Options.TextureSets);
+	FParse::Value(*Params, TEXT("TextureSize="), Options.TextureSize);
+	FParse::Value(*Params, TEXT("ContentPath="), Options.ContentPath);
+	FParse::Value(*Params, TEXT("Skeleton="), Options.SkeletonPath);
+	Options.StaticMeshes = FMath::Max(0, Options.StaticMeshes);
+	Options.SkeletalMeshes = FMath::Max(0, Options.SkeletalMeshes);
+	Options.Triangles = FMath::Max(2, Options.Triangles);
+	Options.Bones = FMath::Clamp(Options.Bones, 1, static_cast<int32>(MAX_uint16));
+	Options.MorphTargets = FMath::Max(0, Options.MorphTargets);
+	Options.TextureSize = FMath::Max(4, Options.TextureSize);
+
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	UBridgeCorpusGenerator::GenerateCorpus(Options, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("%s"), *OutMessage);
+		return 1;
+	}
+	return 0;
+}
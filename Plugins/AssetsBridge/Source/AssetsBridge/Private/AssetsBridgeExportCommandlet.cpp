@@ -0,0 +1,304 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "AssetsBridgeExportCommandlet.h"
+
+#include "AssetsBridge.h"
+#include "AssetsBridgeTools.h"
+#include "BridgeManager.h"
+#include "BridgeManifest.h"
+#include "BridgeStats.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+/** Returns the directory that holds the per-batch manifests and the progress file of a bulk export. */
+static FString GetBulkExportStateDir(const FString& ExportRoot)
+{
+	return FPaths::Combine(ExportRoot, TEXT(".bulk-export"));
+}
+
+/** Returns the binary manifest of one batch of a bulk export. */
+static FString GetBulkExportBatchFile(const FString& StateDir, int32 Batch)
+{
+	return UBridgeManifest::GetFormatPath(FPaths::Combine(StateDir, FString::Printf(TEXT("batch-%06d.json"), Batch)), true);
+}
+
+UAssetsBridgeExportCommandlet::UAssetsBridgeExportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAssetsBridgeExportCommandlet::Main(const FString& Params)
+{
+	FString InputFile;
+	FString OutputFile;
+	if (FParse::Value(*Params, TEXT("Input="), InputFile) && FParse::Value(*Params, TEXT("Output="), OutputFile))
+	{
+		return RunWorker(InputFile, OutputFile);
+	}
+	FString ContentPaths;
+	if (FParse::Value(*Params, TEXT("Path="), ContentPaths, false))
+	{
+		return RunBulkExport(Params, ContentPaths);
+	}
+	UE_LOG(LogAssetsBridge, Error, TEXT("Usage: -run=AssetsBridgeExport -Input=<manifest> -Output=<manifest>"));
+	UE_LOG(LogAssetsBridge, Error, TEXT("   or: -run=AssetsBridgeExport -Path=/Game/<dir>[,...] [-ExportRoot=<dir>] [-BatchSize=<n>] [-ManifestShardSize=<n>] [-Resume]"));
+	return 1;
+}
+
+int32 UAssetsBridgeExportCommandlet::RunWorker(const FString& InputFile, const FString& OutputFile)
+{
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	FBridgeExport Input;
+	UBridgeManifest::ReadFile(InputFile, Input, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("%s"), *OutMessage);
+		return 1;
+	}
+
+	TArray<int32> ItemIndices;
+	for (int32 Idx = 0; Idx < Input.Objects.Num(); Idx++)
+	{
+		FExportAsset& Item = Input.Objects[Idx];
+		Item.ModelPtr = LoadObject<UObject>(nullptr, *Item.Model);
+		if (!Item.ModelPtr)
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Could not load %s"), *Item.Model);
+			continue;
+		}
+		ItemIndices.Add(Idx);
+	}
+
+	TArray<bool> Exported;
+	Exported.Init(false, Input.Objects.Num());
+	UBridgeManager::ExportAssetItems(Input.Objects, ItemIndices, Exported, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("%s"), *OutMessage);
+	}
+
+	FBridgeExport Output;
+	Output.Operation = Input.Operation;
+	for (int32 Idx = 0; Idx < Input.Objects.Num(); Idx++)
+	{
+		if (Exported[Idx])
+		{
+			Output.Objects.Add(Input.Objects[Idx]);
+		}
+	}
+	TArray<uint8> Bytes;
+	UBridgeManifest::WriteBinary(Output, Bytes);
+	if (!FFileHelper::SaveArrayToFile(Bytes, *OutputFile))
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("Could not write %s"), *OutputFile);
+		return 1;
+	}
+
+	UE_LOG(LogAssetsBridge, Display, TEXT("Exported %d of %d asset(s)"), Output.Objects.Num(), Input.Objects.Num());
+	return Output.Objects.Num() == Input.Objects.Num() ? 0 : 1;
+}
+
+int32 UAssetsBridgeExportCommandlet::RunBulkExport(const FString& Params, const FString& ContentPaths)
+{
+	FBridgeOperationScope OperationScope(TEXT("Bulk Export"));
+
+	const FString ExportRoot = UAssetsBridgeTools::ApplyExportRootOverride(Params);
+	if (ExportRoot.IsEmpty())
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("No export root configured, pass -ExportRoot=<dir>"));
+		return 1;
+	}
+	int32 BatchSize = 200;
+	FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+	BatchSize = FMath::Max(1, BatchSize);
+	int32 ManifestShardSize = 0;
+	FParse::Value(*Params, TEXT("ManifestShardSize="), ManifestShardSize);
+	const bool bResume = FParse::Param(*Params, TEXT("Resume"));
+
+	TArray<FString> Paths;
+	ContentPaths.ParseIntoArray(Paths, TEXT(","));
+	for (FString& Path : Paths)
+	{
+		Path.TrimStartAndEndInline();
+		Path.RemoveFromEnd(TEXT("/"));
+	}
+
+	// Only the registry is touched here, the meshes themselves are loaded batch by batch
+	TArray<FAssetData> Assets;
+	{
+		BRIDGE_STAGE_SCOPE("Asset Discovery");
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.ScanPathsSynchronous(Paths, true);
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		for (const FString& Path : Paths)
+		{
+			Filter.PackagePaths.Add(*Path);
+		}
+		Filter.ClassPaths.Add(UStaticMesh::StaticClass()->GetClassPathName());
+		Filter.ClassPaths.Add(USkeletalMesh::StaticClass()->GetClassPathName());
+		AssetRegistry.GetAssets(Filter, Assets);
+		// A stable order is what makes the resume point meaningful
+		Assets.Sort([](const FAssetData& A, const FAssetData& B)
+		{
+			return A.GetObjectPathString() < B.GetObjectPathString();
+		});
+	}
+
+	const FString StateDir = GetBulkExportStateDir(ExportRoot);
+	const FString ProgressFile = FPaths::Combine(StateDir, TEXT("progress.json"));
+	FString LastObjectPath;
+	int32 NextBatch = 0;
+	int32 NumFailed = 0;
+	if (bResume)
+	{
+		FString ProgressText;
+		TSharedPtr<FJsonObject> Progress;
+		if (FFileHelper::LoadFileToString(ProgressText, *ProgressFile)
+			&& FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ProgressText), Progress) && Progress.IsValid())
+		{
+			LastObjectPath = Progress->GetStringField(TEXT("lastObjectPath"));
+			NextBatch = Progress->GetIntegerField(TEXT("nextBatch"));
+			NumFailed = Progress->GetIntegerField(TEXT("failed"));
+			UE_LOG(LogAssetsBridge, Display, TEXT("Resuming after %s"), *LastObjectPath);
+		}
+	}
+	else
+	{
+		IFileManager::Get().DeleteDirectory(*StateDir, false, true);
+	}
+	IFileManager::Get().MakeDirectory(*StateDir, true);
+
+	int32 Start = 0;
+	if (!LastObjectPath.IsEmpty())
+	{
+		while (Start < Assets.Num() && Assets[Start].GetObjectPathString() <= LastObjectPath)
+		{
+			Start++;
+		}
+	}
+	UE_LOG(LogAssetsBridge, Display, TEXT("Found %d mesh(es) under %s, %d left to export"), Assets.Num(), *ContentPaths, Assets.Num() - Start);
+
+	int32 NumExported = 0;
+	int32 NumReused = 0;
+	for (int32 BatchStart = Start; BatchStart < Assets.Num(); BatchStart += BatchSize, NextBatch++)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Assets.Num());
+		TArray<FExportAsset> Items;
+		for (int32 Idx = BatchStart; Idx < BatchEnd; Idx++)
+		{
+			bool bInfoSuccessful = false;
+			FString InfoMessage;
+			FExportAsset Item = UAssetsBridgeTools::GetExportInfo(Assets[Idx], bInfoSuccessful, InfoMessage);
+			if (!bInfoSuccessful)
+			{
+				UE_LOG(LogAssetsBridge, Warning, TEXT("%s: %s"), *Assets[Idx].GetObjectPathString(), *InfoMessage);
+				NumFailed++;
+				continue;
+			}
+			Items.Add(MoveTemp(Item));
+		}
+
+		TArray<bool> Exported;
+		int32 BatchExported = 0;
+		int32 BatchReused = 0;
+		bool bIsSuccessful = false;
+		FString OutMessage;
+		UBridgeManager::ExportAssetsIncremental(Items, Exported, BatchExported, BatchReused, bIsSuccessful, OutMessage);
+		if (!bIsSuccessful)
+		{
+			UE_LOG(LogAssetsBridge, Error, TEXT("%s"), *OutMessage);
+			return 1;
+		}
+		NumExported += BatchExported;
+		NumReused += BatchReused;
+
+		FBridgeExport BatchManifest;
+		for (int32 Idx = 0; Idx < Items.Num(); Idx++)
+		{
+			if (!Exported[Idx])
+			{
+				UE_LOG(LogAssetsBridge, Warning, TEXT("Failed to export %s"), *Items[Idx].Model);
+				NumFailed++;
+				continue;
+			}
+			Items[Idx].ModelPtr = nullptr;
+			BatchManifest.Objects.Add(MoveTemp(Items[Idx]));
+		}
+		Items.Empty();
+
+		// The batch manifest goes first so a crash never records progress for items that are not on disk
+		TArray<uint8> Bytes;
+		UBridgeManifest::WriteBinary(BatchManifest, Bytes);
+		const FString BatchFile = GetBulkExportBatchFile(StateDir, NextBatch);
+		TSharedRef<FJsonObject> Progress = MakeShared<FJsonObject>();
+		Progress->SetStringField(TEXT("lastObjectPath"), Assets[BatchEnd - 1].GetObjectPathString());
+		Progress->SetNumberField(TEXT("nextBatch"), NextBatch + 1);
+		Progress->SetNumberField(TEXT("failed"), NumFailed);
+		FString ProgressText;
+		FJsonSerializer::Serialize(Progress, TJsonWriterFactory<>::Create(&ProgressText));
+		if (!FFileHelper::SaveArrayToFile(Bytes, *BatchFile) || !FFileHelper::SaveStringToFile(ProgressText, *ProgressFile))
+		{
+			UE_LOG(LogAssetsBridge, Error, TEXT("Could not write export progress to %s"), *StateDir);
+			return 1;
+		}
+		UE_LOG(LogAssetsBridge, Display, TEXT("Exported %d of %d mesh(es)"), BatchEnd, Assets.Num());
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	// Gather the batch manifests, including those of earlier runs when resuming
+	FBridgeExport ExportData;
+	ExportData.Operation = "UnrealExport";
+	for (int32 Batch = 0; Batch < NextBatch; Batch++)
+	{
+		FBridgeExport BatchManifest;
+		bool bIsSuccessful = false;
+		FString OutMessage;
+		UBridgeManifest::ReadFile(GetBulkExportBatchFile(StateDir, Batch), BatchManifest, bIsSuccessful, OutMessage);
+		if (!bIsSuccessful)
+		{
+			UE_LOG(LogAssetsBridge, Error, TEXT("%s"), *OutMessage);
+			return 1;
+		}
+		ExportData.Objects.Append(MoveTemp(BatchManifest.Objects));
+	}
+
+	const int32 NumObjects = ExportData.Objects.Num();
+	const int32 ShardSize = ManifestShardSize > 0 ? ManifestShardSize : FMath::Max(1, NumObjects);
+	for (int32 ShardStart = 0, Shard = 0; ShardStart < FMath::Max(1, NumObjects); ShardStart += ShardSize, Shard++)
+	{
+		FBridgeExport ShardData;
+		ShardData.Operation = ExportData.Operation;
+		for (int32 Idx = ShardStart; Idx < FMath::Min(ShardStart + ShardSize, NumObjects); Idx++)
+		{
+			ShardData.Objects.Add(MoveTemp(ExportData.Objects[Idx]));
+		}
+		const FString ManifestFile = FPaths::Combine(ExportRoot, ManifestShardSize > 0
+			                                                       ? FString::Printf(TEXT("from-unreal-%d.json"), Shard)
+			                                                       : FString(TEXT("from-unreal.json")));
+		bool bIsSuccessful = false;
+		FString OutMessage;
+		UAssetsBridgeTools::WriteBridgeExportFileAt(ShardData, ManifestFile, bIsSuccessful, OutMessage);
+		if (!bIsSuccessful)
+		{
+			UE_LOG(LogAssetsBridge, Error, TEXT("%s"), *OutMessage);
+			return 1;
+		}
+	}
+	IFileManager::Get().DeleteDirectory(*StateDir, false, true);
+
+	UE_LOG(LogAssetsBridge, Display, TEXT("Bulk export finished: %d in manifest, exported %d, reused %d unchanged, %d failed"),
+	       NumObjects, NumExported, NumReused, NumFailed);
+	return NumFailed == 0 ? 0 : 1;
+}
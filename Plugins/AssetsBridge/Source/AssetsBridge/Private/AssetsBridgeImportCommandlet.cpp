@@ -0,0 +1,99 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "AssetsBridgeImportCommandlet.h"
+
+#include "AssetsBridge.h"
+#include "AssetsBridgeTools.h"
+#include "BridgeManager.h"
+#include "FileHelpers.h"
+#include "JsonObjectConverter.h"
+
+UAssetsBridgeImportCommandlet::UAssetsBridgeImportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAssetsBridgeImportCommandlet::Main(const FString& Params)
+{
+	const FString ExportRoot = UAssetsBridgeTools::ApplyExportRootOverride(Params);
+
+	FBridgeImportOptions Options;
+	FParse::Value(*Params, TEXT("Manifest="), Options.ManifestPath);
+	FParse::Value(*Params, TEXT("ShardIndex="), Options.ShardIndex);
+	FParse::Value(*Params, TEXT("ShardCount="), Options.ShardCount);
+	Options.bForceReimport = FParse::Param(*Params, TEXT("Force"));
+	const bool bSave = !FParse::Param(*Params, TEXT("NoSave"));
+
+	if (Options.ManifestPath.IsEmpty() && ExportRoot.IsEmpty())
+	{
+		UE_LOG(LogAssetsBridge, Error, TEXT("Usage: -run=AssetsBridgeImport [-ExportRoot=<dir>] [-Manifest=<file>] [-Summary=<file>] [-ShardIndex=<n> -ShardCount=<n>] [-Force] [-NoSave]"));
+		return 2;
+	}
+
+	FString SummaryPath;
+	if (!FParse::Value(*Params, TEXT("Summary="), SummaryPath))
+	{
+		const FString ManifestDir = Options.ManifestPath.IsEmpty() ? ExportRoot : FPaths::GetPath(Options.ManifestPath);
+		SummaryPath = FPaths::Combine(ManifestDir, Options.ShardCount > 1
+			                                           ? FString::Printf(TEXT("import-summary-%d.json"), Options.ShardIndex)
+			                                           : FString(TEXT("import-summary.json")));
+	}
+
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	TArray<FBridgeImportItemResult> Results;
+	UBridgeManager::GenerateImportWithResults(Options, Results, bIsSuccessful, OutMessage);
+	const bool bManifestRead = bIsSuccessful || Results.Num() > 0;
+	UE_LOG(LogAssetsBridge, Display, TEXT("%s"), *OutMessage);
+
+	int32 NumSaved = 0;
+	bool bSaved = true;
+	if (bSave && bManifestRead)
+	{
+		TArray<UPackage*> DirtyPackages;
+		FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+		NumSaved = DirtyPackages.Num();
+		bSaved = DirtyPackages.Num() == 0 || UEditorLoadingAndSavingUtils::SavePackages(DirtyPackages, true);
+		UE_LOG(LogAssetsBridge, Display, TEXT("Saved %d package(s)%s"), NumSaved, bSaved ? TEXT("") : TEXT(" with errors"));
+	}
+
+	int32 NumImported = 0;
+	int32 NumSkipped = 0;
+	int32 NumFailed = 0;
+	TArray<TSharedPtr<FJsonValue>> Items;
+	for (const FBridgeImportItemResult& Result : Results)
+	{
+		NumSkipped += Result.bSkipped ? 1 : 0;
+		NumImported += Result.bIsSuccessful && !Result.bSkipped ? 1 : 0;
+		NumFailed += Result.bIsSuccessful ? 0 : 1;
+		if (TSharedPtr<FJsonObject> Item = FJsonObjectConverter::UStructToJsonObject(Result))
+		{
+			Items.Add(MakeShared<FJsonValueObject>(Item));
+		}
+	}
+
+	const int32 ExitCode = !bManifestRead ? 2 : !bSaved ? 3 : NumFailed > 0 ? 1 : 0;
+
+	TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+	Summary->SetNumberField(TEXT("exitCode"), ExitCode);
+	Summary->SetStringField(TEXT("message"), OutMessage);
+	Summary->SetStringField(TEXT("manifest"), Options.ManifestPath.IsEmpty() ? FPaths::Combine(ExportRoot, TEXT("from-blender.json")) : Options.ManifestPath);
+	Summary->SetNumberField(TEXT("shardIndex"), Options.ShardIndex);
+	Summary->SetNumberField(TEXT("shardCount"), Options.ShardCount);
+	Summary->SetNumberField(TEXT("imported"), NumImported);
+	Summary->SetNumberField(TEXT("skipped"), NumSkipped);
+	Summary->SetNumberField(TEXT("failed"), NumFailed);
+	Summary->SetNumberField(TEXT("savedPackages"), NumSaved);
+	Summary->SetObjectField(TEXT("stats"), FJsonObjectConverter::UStructToJsonObject(UBridgeManager::GetLastOperationStats()));
+	Summary->SetArrayField(TEXT("items"), Items);
+
+	bool bWroteSummary = false;
+	FString SummaryMessage;
+	UAssetsBridgeTools::WriteJson(SummaryPath, Summary, bWroteSummary, SummaryMessage);
+	UE_LOG(LogAssetsBridge, Display, TEXT("%s"), *SummaryMessage);
+
+	return ExitCode;
+}
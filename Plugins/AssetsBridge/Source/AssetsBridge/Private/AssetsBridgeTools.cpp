@@ -3,6 +3,9 @@
 #include "AssetsBridgeTools.h"
 
 #include "ABSettings.h"
+#include "AssetsBridge.h"
+#include "BridgeStats.h"
+#include "BridgeManifest.h"
 #include "ContentBrowserModule.h"
 #include "EditorDirectories.h"
 #include "IContentBrowserSingleton.h"
@@ -17,18 +20,38 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/MorphTarget.h"
 #include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "InterchangeManager.h"
+#include "InterchangeProjectSettings.h"
+#include "InterchangeSourceData.h"
+#include "InterchangeTranslatorBase.h"
 #include "Misc/FileHelper.h"
 #include "Serialization/JsonSerializer.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
+bool UAssetsBridgeTools::IsUnattended()
+{
+	return FApp::IsUnattended() || IsRunningCommandlet();
+}
+
 void UAssetsBridgeTools::ShowInfoDialog(FString Message)
 {
+	if (IsUnattended())
+	{
+		UE_LOG(LogAssetsBridge, Display, TEXT("%s"), *Message);
+		return;
+	}
 	FText DialogText = FText::FromString(Message);
 	FMessageDialog::Open(EAppMsgType::Ok, DialogText);
 }
 
 void UAssetsBridgeTools::ShowNotification(FString Message)
 {
+	if (IsUnattended())
+	{
+		UE_LOG(LogAssetsBridge, Display, TEXT("%s"), *Message);
+		return;
+	}
 	FSlateNotificationManager::Get().AddNotification(FNotificationInfo(FText::FromString(Message)));
 }
 
@@ -38,7 +61,7 @@ FString UAssetsBridgeTools::GetExportPathFromInternal(FString NewInternalPath, F
 	GetExportRoot(AssetHome);
 	// TODO: Strip Engine / Game / Other folders from the start.
 	FString NewExportPath = FPaths::Combine(AssetHome, NewInternalPath, NewName.Append(".glb"));
-	UE_LOG(LogTemp, Warning, TEXT("Adding new export path: %s"), *NewExportPath)
+	UE_LOG(LogAssetsBridge, Warning, TEXT("Adding new export path: %s"), *NewExportPath)
 	return NewExportPath;
 }
 
@@ -50,16 +73,40 @@ FBridgeExport UAssetsBridgeTools::ReadBridgeExportFile(bool& bIsSuccessful, FStr
 	FString JsonFilePath = FPaths::Combine(AssetBase, "from-blender.json");
 	
 	// Fallback to legacy file if new format doesn't exist
-	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*JsonFilePath))
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*UBridgeManifest::ResolveReadPath(JsonFilePath)))
 	{
 		FString LegacyPath = FPaths::Combine(AssetBase, "AssetBridge.json");
 		if (FPlatformFileManager::Get().GetPlatformFile().FileExists(*LegacyPath))
 		{
 			JsonFilePath = LegacyPath;
-			UE_LOG(LogTemp, Warning, TEXT("Using legacy AssetBridge.json - consider updating Blender addon to use from-blender.json"));
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Using legacy AssetBridge.json - consider updating Blender addon to use from-blender.json"));
 		}
 	}
 	
+	return ReadBridgeExportFileAt(JsonFilePath, bIsSuccessful, OutMessage);
+}
+
+FBridgeExport UAssetsBridgeTools::ReadBridgeExportFileAt(const FString& InFilePath, bool& bIsSuccessful, FString& OutMessage)
+{
+	BRIDGE_STAGE_SCOPE("Manifest Read");
+	// Binary manifests sit next to the .json name with their own extension
+	const FString JsonFilePath = UBridgeManifest::ResolveReadPath(InFilePath);
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*JsonFilePath))
+	{
+		bIsSuccessful = false;
+		OutMessage = FString::Printf(TEXT("failed to open file for reading: '%s'"), *JsonFilePath);
+		return FBridgeExport();
+	}
+
+	// Stream straight from the file bytes; large manifests never get a DOM or a widened copy
+	FBridgeExport ReturnData;
+	UBridgeManifest::ReadFile(JsonFilePath, ReturnData, bIsSuccessful, OutMessage);
+	if (bIsSuccessful)
+	{
+		return ReturnData;
+	}
+	UE_LOG(LogAssetsBridge, Warning, TEXT("Streaming manifest read failed (%s), falling back to the json object reader"), *OutMessage);
+
 	// Try to read generic text into json object
 	TSharedPtr<FJsonObject> JSONObject = ReadJson(JsonFilePath, bIsSuccessful, OutMessage);
 	{
@@ -68,7 +115,6 @@ FBridgeExport UAssetsBridgeTools::ReadBridgeExportFile(bool& bIsSuccessful, FStr
 			return FBridgeExport();
 		}
 	}
-	FBridgeExport ReturnData;
 	if (!FJsonObjectConverter::JsonObjectToUStruct<FBridgeExport>(JSONObject.ToSharedRef(), &ReturnData))
 	{
 		bIsSuccessful = false;
@@ -82,6 +128,30 @@ FBridgeExport UAssetsBridgeTools::ReadBridgeExportFile(bool& bIsSuccessful, FStr
 
 void UAssetsBridgeTools::WriteBridgeExportFile(FBridgeExport Data, bool& bIsSuccessful, FString& OutMessage)
 {
+	// Write to Unreal's export file (bidirectional: Unreal writes from-unreal.json, Blender reads it)
+	FString BridgeName = "from-unreal.json";
+	FString AssetBase;
+	GetExportRoot(AssetBase);
+	FString JsonFilePath = FPaths::Combine(AssetBase, BridgeName);
+	WriteBridgeExportFileAt(Data, JsonFilePath, bIsSuccessful, OutMessage);
+}
+
+void UAssetsBridgeTools::WriteBridgeExportFileAt(const FBridgeExport& Data, const FString& JsonFilePath, bool& bIsSuccessful, FString& OutMessage)
+{
+	BRIDGE_STAGE_SCOPE("Manifest Write");
+	// The binary layout gets its own extension so JSON consumers such as the Blender add-on never read it
+	if (GetDefault<UABSettings>()->ManifestFormat == EBridgeManifestFormat::Binary)
+	{
+		const FString BinaryFilePath = UBridgeManifest::GetFormatPath(JsonFilePath, true);
+		TArray<uint8> Bytes;
+		UBridgeManifest::WriteBinary(Data, Bytes);
+		bIsSuccessful = FFileHelper::SaveArrayToFile(Bytes, *BinaryFilePath);
+		OutMessage = bIsSuccessful
+			             ? FString::Printf(TEXT("Exported %d objects to %s"), Data.Objects.Num(), *BinaryFilePath)
+			             : FString::Printf(TEXT("failed to write file: '%s'"), *BinaryFilePath);
+		return;
+	}
+
 	TSharedPtr<FJsonObject> JsonObject = FJsonObjectConverter::UStructToJsonObject(Data);
 	if (JsonObject == nullptr)
 	{
@@ -89,11 +159,6 @@ void UAssetsBridgeTools::WriteBridgeExportFile(FBridgeExport Data, bool& bIsSucc
 		OutMessage = FString::Printf(TEXT("Invalid struct received, cannot convert to json"));
 		return;
 	}
-	// Write to Unreal's export file (bidirectional: Unreal writes from-unreal.json, Blender reads it)
-	FString BridgeName = "from-unreal.json";
-	FString AssetBase;
-	GetExportRoot(AssetBase);
-	FString JsonFilePath = FPaths::Combine(AssetBase, BridgeName);
 	WriteJson(JsonFilePath, JsonObject, bIsSuccessful, OutMessage);
 	
 	if (bIsSuccessful)
@@ -141,14 +206,14 @@ void UAssetsBridgeTools::GetSelectedContentBrowserPath(FString& OutContentLocati
 	// First select the last view item.
 	for (auto Asset : OutViewFolders)
 	{
-		// UE_LOG(LogTemp, Warning, TEXT("View Folder is: %s"), *Asset)
+		// UE_LOG(LogAssetsBridge, Warning, TEXT("View Folder is: %s"), *Asset)
 		//  We do a replace since "show all" in content browser can cause a change in the virtual path
 		OutContentLocation = Asset.Replace(TEXT("/All"), TEXT(""));
 	}
 	// Now we iterate through the non view path and select here.
 	for (auto Asset : OutSelectedFolders)
 	{
-		// UE_LOG(LogTemp, Warning, TEXT("Asset is: %s"), *Asset)
+		// UE_LOG(LogAssetsBridge, Warning, TEXT("Asset is: %s"), *Asset)
 		//  We do a replace since "show all" in content browser can cause a change in the virtual path
 		OutContentLocation = Asset.Replace(TEXT("/All"), TEXT(""));
 	}
@@ -279,6 +344,103 @@ TSharedPtr<FJsonObject> UAssetsBridgeTools::ReadJson(FString FilePath, bool& bIs
 	return ReturnObj;
 }
 
+TSharedPtr<FJsonObject> UAssetsBridgeTools::ReadGltfJson(const FString& FilePath, bool& bIsSuccessful, FString& OutMessage)
+{
+	bIsSuccessful = false;
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		OutMessage = FString::Printf(TEXT("Could not read %s"), *FilePath);
+		return nullptr;
+	}
+
+	// A .glb is a 12 byte header ("glTF", version, length) followed by chunks; the first one is the JSON,
+	// so only that chunk is read and the (much larger) binary buffer is never loaded
+	constexpr uint32 GlbMagic = 0x46546C67;
+	constexpr uint32 JsonChunkType = 0x4E4F534A;
+	uint32 Header[5] = {};
+	const int64 FileSize = Reader->TotalSize();
+	if (FileSize >= static_cast<int64>(sizeof(Header)))
+	{
+		Reader->Serialize(Header, sizeof(Header));
+	}
+	TArray<uint8> Bytes;
+	if (INTEL_ORDER32(Header[0]) == GlbMagic)
+	{
+		const uint32 ChunkLength = INTEL_ORDER32(Header[3]);
+		if (INTEL_ORDER32(Header[4]) != JsonChunkType || sizeof(Header) + ChunkLength > static_cast<uint64>(FileSize))
+		{
+			OutMessage = FString::Printf(TEXT("%s is not a valid glb file"), *FilePath);
+			return nullptr;
+		}
+		Bytes.SetNumUninitialized(ChunkLength);
+	}
+	else
+	{
+		Reader->Seek(0);
+		Bytes.SetNumUninitialized(FileSize);
+	}
+	Reader->Serialize(Bytes.GetData(), Bytes.Num());
+	if (!Reader->Close())
+	{
+		OutMessage = FString::Printf(TEXT("Could not read %s"), *FilePath);
+		return nullptr;
+	}
+
+	const FUTF8ToTCHAR Text(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num());
+	TSharedPtr<FJsonObject> ReturnObj;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(Text.Length(), Text.Get())), ReturnObj) || !ReturnObj.IsValid())
+	{
+		OutMessage = FString::Printf(TEXT("failed to read glTF json of %s"), *FilePath);
+		return nullptr;
+	}
+	bIsSuccessful = true;
+	OutMessage = FString::Printf(TEXT("glTF json read success from %s"), *FilePath);
+	return ReturnObj;
+}
+
+TArray<FSoftObjectPath> UAssetsBridgeTools::GetProjectImportPipelines(const FString& FilePath)
+{
+	// Same lookup as an import without overrides: the default stack, then its list for the file's translator
+	UInterchangeManager& InterchangeManager = UInterchangeManager::GetInterchangeManager();
+	const UInterchangeSourceData* SourceData = UInterchangeManager::CreateSourceData(FilePath);
+	const FInterchangeImportSettings& ImportSettings = FInterchangeProjectSettingsUtils::GetDefaultImportSettings(false);
+	const FInterchangePipelineStack* Stack = ImportSettings.PipelineStacks.Find(
+		FInterchangeProjectSettingsUtils::GetDefaultPipelineStackName(false, *SourceData));
+	if (!Stack)
+	{
+		return TArray<FSoftObjectPath>();
+	}
+	if (const UInterchangeTranslatorBase* Translator = InterchangeManager.GetTranslatorForSourceData(SourceData))
+	{
+		for (const FInterchangeTranslatorPipelines& TranslatorPipelines : Stack->PerTranslatorPipelines)
+		{
+			const UClass* TranslatorClass = TranslatorPipelines.Translator.LoadSynchronous();
+			if (TranslatorClass && Translator->IsA(TranslatorClass))
+			{
+				return TranslatorPipelines.Pipelines;
+			}
+		}
+	}
+	return Stack->Pipelines;
+}
+
+TArray<UObject*> UAssetsBridgeTools::GetStackPipelines(const UInterchangePipelineStackOverride* Stack)
+{
+	TArray<UObject*> Pipelines;
+	if (Stack)
+	{
+		for (const FSoftObjectPath& PipelinePath : Stack->OverridePipelines)
+		{
+			if (UObject* Pipeline = PipelinePath.ResolveObject())
+			{
+				Pipelines.Add(Pipeline);
+			}
+		}
+	}
+	return Pipelines;
+}
+
 void UAssetsBridgeTools::WriteJson(FString FilePath, TSharedPtr<FJsonObject> JsonObject, bool& bIsSuccessful,
                                    FString& OutMessage)
 {
@@ -351,6 +513,17 @@ void UAssetsBridgeTools::SetExportRoot(FString InLocation)
 	}
 }
 
+FString UAssetsBridgeTools::ApplyExportRootOverride(const FString& Params)
+{
+	FString ExportRoot;
+	if (FParse::Value(*Params, TEXT("ExportRoot="), ExportRoot))
+	{
+		GetMutableDefault<UABSettings>()->AssetLocationOnDisk = ExportRoot;
+	}
+	GetExportRoot(ExportRoot);
+	return ExportRoot;
+}
+
 FString UAssetsBridgeTools::BrowseForExportRoot()
 {
 	// Use the existing GetOSDirectoryLocation to open a folder browser
@@ -418,7 +591,7 @@ TArray<FAssetData> UAssetsBridgeTools::GetAssetsFromActor(const AActor* InActor)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Provided actor is null."))
+		UE_LOG(LogAssetsBridge, Error, TEXT("Provided actor is null."))
 	}
 	return Assets;
 }
@@ -525,7 +698,12 @@ FExportAsset UAssetsBridgeTools::GetExportInfo(FAssetData AssetInfo, bool& bIsSu
 			if (MorphTarget)
 			{
 				Result.MorphTargets.Add(MorphTarget->GetName());
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Captured morph target: %s"), *MorphTarget->GetName());
+				// Exported empty so the next import keeps it rather than pruning it
+				if (!MorphTarget->HasValidData())
+				{
+					Result.KeepEmptyMorphTargets.Add(MorphTarget->GetName());
+				}
+				UE_LOG(LogAssetsBridge, Log, TEXT("Captured morph target: %s"), *MorphTarget->GetName());
 			}
 		}
 		TArray<FSkeletalMaterial> Materials = SkeletalMesh->GetMaterials();
@@ -0,0 +1,486 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeCorpusGenerator.h"
+
+#include "AssetsBridge.h"
+#include "ImageUtils.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+
+// glTF constants used by the generator
+static constexpr int32 GltfFloat = 5126;
+static constexpr int32 GltfUnsignedShort = 5123;
+static constexpr int32 GltfUnsignedInt = 5125;
+static constexpr int32 GltfArrayBuffer = 34962;
+static constexpr int32 GltfElementArrayBuffer = 34963;
+
+/** Material every unchanged corpus slot points at; it ships with the engine so the corpus works in any project. */
+static const TCHAR* CorpusMaterialPath = TEXT("/Engine/BasicShapes/BasicShapeMaterial");
+
+/** What a corpus morph target does; the import's morph pruning drops the empty and negligible ones unless kept */
+enum class ECorpusMorph : uint8
+{
+	Banded,
+	Negligible,
+	Empty,
+	KeptEmpty,
+};
+
+/** One in eight morph targets is empty and one in eight only moves below the default prune threshold */
+static ECorpusMorph GetCorpusMorphKind(int32 Morph)
+{
+	switch (Morph % 16)
+	{
+	case 6:
+	case 14:
+		return ECorpusMorph::Negligible;
+	case 7:
+		return ECorpusMorph::Empty;
+	case 15:
+		return ECorpusMorph::KeptEmpty;
+	default:
+		return ECorpusMorph::Banded;
+	}
+}
+
+/** Collects buffer views and accessors over a single binary chunk and packs them into a .glb. */
+struct FGlbWriter
+{
+	TArray<uint8> Bin;
+	TArray<TSharedPtr<FJsonValue>> BufferViews;
+	TArray<TSharedPtr<FJsonValue>> Accessors;
+
+	/** Appends Count elements and returns the accessor index. Min/Max are required for positions. */
+	int32 AddAccessor(const void* Data, int64 NumBytes, int32 ComponentType, int32 Count, const TCHAR* Type, int32 Target,
+	                  const FVector3f* Min = nullptr, const FVector3f* Max = nullptr)
+	{
+		Bin.SetNumZeroed(Align(Bin.Num(), 4));
+		const int32 Offset = Bin.Num();
+		Bin.Append(static_cast<const uint8*>(Data), NumBytes);
+
+		TSharedRef<FJsonObject> View = MakeShared<FJsonObject>();
+		View->SetNumberField(TEXT("buffer"), 0);
+		View->SetNumberField(TEXT("byteOffset"), Offset);
+		View->SetNumberField(TEXT("byteLength"), NumBytes);
+		if (Target != 0)
+		{
+			View->SetNumberField(TEXT("target"), Target);
+		}
+		BufferViews.Add(MakeShared<FJsonValueObject>(View));
+
+		TSharedRef<FJsonObject> Accessor = MakeShared<FJsonObject>();
+		Accessor->SetNumberField(TEXT("bufferView"), BufferViews.Num() - 1);
+		Accessor->SetNumberField(TEXT("componentType"), ComponentType);
+		Accessor->SetNumberField(TEXT("count"), Count);
+		Accessor->SetStringField(TEXT("type"), Type);
+		if (Min && Max)
+		{
+			Accessor->SetArrayField(TEXT("min"), {MakeShared<FJsonValueNumber>(Min->X), MakeShared<FJsonValueNumber>(Min->Y), MakeShared<FJsonValueNumber>(Min->Z)});
+			Accessor->SetArrayField(TEXT("max"), {MakeShared<FJsonValueNumber>(Max->X), MakeShared<FJsonValueNumber>(Max->Y), MakeShared<FJsonValueNumber>(Max->Z)});
+		}
+		Accessors.Add(MakeShared<FJsonValueObject>(Accessor));
+		return Accessors.Num() - 1;
+	}
+
+	template <typename T>
+	int32 AddAccessor(const TArray<T>& Data, int32 ComponentType, int32 Count, const TCHAR* Type, int32 Target,
+	                  const FVector3f* Min = nullptr, const FVector3f* Max = nullptr)
+	{
+		return AddAccessor(Data.GetData(), Data.NumBytes(), ComponentType, Count, Type, Target, Min, Max);
+	}
+
+	/** Adds the buffer tables to Root and writes header, JSON chunk and BIN chunk. */
+	void Finish(const TSharedRef<FJsonObject>& Root, TArray<uint8>& OutBytes)
+	{
+		Bin.SetNumZeroed(Align(Bin.Num(), 4));
+		TSharedRef<FJsonObject> Buffer = MakeShared<FJsonObject>();
+		Buffer->SetNumberField(TEXT("byteLength"), Bin.Num());
+		Root->SetArrayField(TEXT("buffers"), {MakeShared<FJsonValueObject>(Buffer)});
+		Root->SetArrayField(TEXT("bufferViews"), BufferViews);
+		Root->SetArrayField(TEXT("accessors"), Accessors);
+
+		FString JsonText;
+		FJsonSerializer::Serialize(Root, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonText));
+		FTCHARToUTF8 Utf8(*JsonText);
+		TArray<uint8> Json(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		while (Json.Num() % 4 != 0)
+		{
+			Json.Add(' ');
+		}
+
+		const uint32 Header[] = {0x46546C67, 2, static_cast<uint32>(12 + 8 + Json.Num() + 8 + Bin.Num())};
+		const uint32 JsonChunk[] = {static_cast<uint32>(Json.Num()), 0x4E4F534A};
+		const uint32 BinChunk[] = {static_cast<uint32>(Bin.Num()), 0x004E4942};
+		OutBytes.Reset(Header[2]);
+		OutBytes.Append(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+		OutBytes.Append(reinterpret_cast<const uint8*>(JsonChunk), sizeof(JsonChunk));
+		OutBytes.Append(Json);
+		OutBytes.Append(reinterpret_cast<const uint8*>(BinChunk), sizeof(BinChunk));
+		OutBytes.Append(Bin);
+	}
+};
+
+void UBridgeCorpusGenerator::BuildStripGlb(FRandomStream& Stream, int32 Triangles, int32 Bones, int32 MorphTargets,
+                                           const TArray<FString>& MaterialNames, TArray<uint8>& OutBytes)
+{
+	const bool bSkinned = Bones > 0;
+	const int32 NumPrimitives = FMath::Max(1, MaterialNames.Num());
+	const int32 NumQuads = FMath::Max(1, (Triangles + 1) / 2);
+	const int32 Columns = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumQuads))));
+	const int32 Rows = FMath::Max(NumPrimitives, FMath::DivideAndRoundUp(NumQuads, Columns));
+	const int32 RowStride = Columns + 1;
+	const int32 NumVertices = RowStride * (Rows + 1);
+	const float Width = 1.0f;
+	const float Height = bSkinned ? 2.0f : 1.0f;
+
+	// A vertical strip in glTF's Y-up space, jittered along Z so it is not degenerate
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	TArray<FVector2f> UVs;
+	Positions.Reserve(NumVertices);
+	Normals.Init(FVector3f(0.0f, 0.0f, 1.0f), NumVertices);
+	UVs.Reserve(NumVertices);
+	FVector3f Min(TNumericLimits<float>::Max());
+	FVector3f Max(TNumericLimits<float>::Lowest());
+	for (int32 Row = 0; Row <= Rows; Row++)
+	{
+		for (int32 Col = 0; Col <= Columns; Col++)
+		{
+			const FVector3f Position(Width * Col / Columns - Width * 0.5f, Height * Row / Rows, Stream.FRandRange(-0.01f, 0.01f));
+			Positions.Add(Position);
+			UVs.Add(FVector2f(static_cast<float>(Col) / Columns, 1.0f - static_cast<float>(Row) / Rows));
+			Min = FVector3f::Min(Min, Position);
+			Max = FVector3f::Max(Max, Position);
+		}
+	}
+
+	FGlbWriter Writer;
+	const int32 PositionAccessor = Writer.AddAccessor(Positions, GltfFloat, NumVertices, TEXT("VEC3"), GltfArrayBuffer, &Min, &Max);
+	const int32 NormalAccessor = Writer.AddAccessor(Normals, GltfFloat, NumVertices, TEXT("VEC3"), GltfArrayBuffer);
+	const int32 UVAccessor = Writer.AddAccessor(UVs, GltfFloat, NumVertices, TEXT("VEC2"), GltfArrayBuffer);
+
+	TSharedRef<FJsonObject> Attributes = MakeShared<FJsonObject>();
+	Attributes->SetNumberField(TEXT("POSITION"), PositionAccessor);
+	Attributes->SetNumberField(TEXT("NORMAL"), NormalAccessor);
+	Attributes->SetNumberField(TEXT("TEXCOORD_0"), UVAccessor);
+
+	// Each row band is rigidly bound to one bone of the chain
+	const float BoneLength = bSkinned ? Height / Bones : 0.0f;
+	if (bSkinned)
+	{
+		TArray<uint16> Joints;
+		TArray<float> Weights;
+		Joints.SetNumZeroed(NumVertices * 4);
+		Weights.SetNumZeroed(NumVertices * 4);
+		for (int32 Idx = 0; Idx < NumVertices; Idx++)
+		{
+			Joints[Idx * 4] = static_cast<uint16>(FMath::Min(Bones - 1, FMath::FloorToInt(Positions[Idx].Y / BoneLength)));
+			Weights[Idx * 4] = 1.0f;
+		}
+		Attributes->SetNumberField(TEXT("JOINTS_0"), Writer.AddAccessor(Joints, GltfUnsignedShort, NumVertices, TEXT("VEC4"), GltfArrayBuffer));
+		Attributes->SetNumberField(TEXT("WEIGHTS_0"), Writer.AddAccessor(Weights, GltfFloat, NumVertices, TEXT("VEC4"), GltfArrayBuffer));
+	}
+
+	// Morphs displace a random band of rows and leave the rest untouched, like typical facial shapes. Negligible
+	// ones move their band by at most half a millimetre in glTF metres, 0.005 cm after import; empty ones not at all
+	TArray<TSharedPtr<FJsonValue>> Targets;
+	TArray<TSharedPtr<FJsonValue>> TargetNames;
+	TArray<TSharedPtr<FJsonValue>> TargetWeights;
+	for (int32 Morph = 0; bSkinned && Morph < MorphTargets; Morph++)
+	{
+		const int32 BandStart = Stream.RandRange(0, Rows);
+		const int32 BandEnd = FMath::Min(Rows, BandStart + Stream.RandRange(1, FMath::Max(1, Rows / 4)));
+		const ECorpusMorph Kind = GetCorpusMorphKind(Morph);
+		const float BandedAmplitude = Stream.FRandRange(0.01f, 0.1f);
+		const float Amplitude = Kind == ECorpusMorph::Banded ? BandedAmplitude : (Kind == ECorpusMorph::Negligible ? 0.00005f : 0.0f);
+		const float Frequency = Stream.FRandRange(1.0f, 4.0f);
+		TArray<FVector3f> Deltas;
+		Deltas.SetNumZeroed(NumVertices);
+		FVector3f DeltaMin(0.0f);
+		FVector3f DeltaMax(0.0f);
+		for (int32 Row = BandStart; Row <= BandEnd; Row++)
+		{
+			for (int32 Col = 0; Col <= Columns; Col++)
+			{
+				const FVector3f Delta(0.0f, 0.0f, Amplitude * FMath::Sin(UE_TWO_PI * Frequency * Col / Columns));
+				Deltas[Row * RowStride + Col] = Delta;
+				DeltaMin = FVector3f::Min(DeltaMin, Delta);
+				DeltaMax = FVector3f::Max(DeltaMax, Delta);
+			}
+		}
+		TSharedRef<FJsonObject> Target = MakeShared<FJsonObject>();
+		Target->SetNumberField(TEXT("POSITION"), Writer.AddAccessor(Deltas, GltfFloat, NumVertices, TEXT("VEC3"), GltfArrayBuffer, &DeltaMin, &DeltaMax));
+		Targets.Add(MakeShared<FJsonValueObject>(Target));
+		TargetNames.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Morph_%03d"), Morph)));
+		TargetWeights.Add(MakeShared<FJsonValueNumber>(0.0));
+	}
+
+	// One primitive per material slot, each covering its own band of rows
+	TArray<TSharedPtr<FJsonValue>> Primitives;
+	TArray<TSharedPtr<FJsonValue>> Materials;
+	for (int32 Primitive = 0; Primitive < NumPrimitives; Primitive++)
+	{
+		TArray<uint32> Indices;
+		for (int32 Row = Rows * Primitive / NumPrimitives; Row < Rows * (Primitive + 1) / NumPrimitives; Row++)
+		{
+			for (int32 Col = 0; Col < Columns; Col++)
+			{
+				const uint32 I0 = Row * RowStride + Col;
+				const uint32 I1 = I0 + 1;
+				const uint32 I2 = I0 + RowStride;
+				const uint32 I3 = I2 + 1;
+				Indices.Append({I0, I1, I2, I1, I3, I2});
+			}
+		}
+		TSharedRef<FJsonObject> PrimitiveObject = MakeShared<FJsonObject>();
+		PrimitiveObject->SetObjectField(TEXT("attributes"), Attributes);
+		PrimitiveObject->SetNumberField(TEXT("indices"), Writer.AddAccessor(Indices, GltfUnsignedInt, Indices.Num(), TEXT("SCALAR"), GltfElementArrayBuffer));
+		PrimitiveObject->SetNumberField(TEXT("material"), Primitive);
+		if (Targets.Num() > 0)
+		{
+			PrimitiveObject->SetArrayField(TEXT("targets"), Targets);
+		}
+		Primitives.Add(MakeShared<FJsonValueObject>(PrimitiveObject));
+
+		TSharedRef<FJsonObject> Material = MakeShared<FJsonObject>();
+		Material->SetStringField(TEXT("name"), MaterialNames.IsValidIndex(Primitive) ? MaterialNames[Primitive] : FString(TEXT("Material")));
+		Materials.Add(MakeShared<FJsonValueObject>(Material));
+	}
+
+	TSharedRef<FJsonObject> Mesh = MakeShared<FJsonObject>();
+	Mesh->SetStringField(TEXT("name"), TEXT("Strip"));
+	Mesh->SetArrayField(TEXT("primitives"), Primitives);
+	if (Targets.Num() > 0)
+	{
+		Mesh->SetArrayField(TEXT("weights"), TargetWeights);
+		TSharedRef<FJsonObject> Extras = MakeShared<FJsonObject>();
+		Extras->SetArrayField(TEXT("targetNames"), TargetNames);
+		Mesh->SetObjectField(TEXT("extras"), Extras);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Nodes;
+	TSharedRef<FJsonObject> MeshNode = MakeShared<FJsonObject>();
+	MeshNode->SetStringField(TEXT("name"), TEXT("Strip"));
+	MeshNode->SetNumberField(TEXT("mesh"), 0);
+	TArray<TSharedPtr<FJsonValue>> SceneNodes = {MakeShared<FJsonValueNumber>(0)};
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	if (bSkinned)
+	{
+		MeshNode->SetNumberField(TEXT("skin"), 0);
+		TArray<TSharedPtr<FJsonValue>> Joints;
+		TArray<float> InverseBindMatrices;
+		for (int32 Bone = 0; Bone < Bones; Bone++)
+		{
+			TSharedRef<FJsonObject> BoneNode = MakeShared<FJsonObject>();
+			BoneNode->SetStringField(TEXT("name"), FString::Printf(TEXT("Bone_%03d"), Bone));
+			BoneNode->SetArrayField(TEXT("translation"), {MakeShared<FJsonValueNumber>(0.0), MakeShared<FJsonValueNumber>(Bone == 0 ? 0.0 : BoneLength), MakeShared<FJsonValueNumber>(0.0)});
+			if (Bone + 1 < Bones)
+			{
+				BoneNode->SetArrayField(TEXT("children"), {MakeShared<FJsonValueNumber>(Bone + 2)});
+			}
+			Nodes.Add(MakeShared<FJsonValueObject>(BoneNode));
+			Joints.Add(MakeShared<FJsonValueNumber>(Bone + 1));
+			// Column-major inverse of a translation up the chain
+			InverseBindMatrices.Append({1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -BoneLength * Bone, 0, 1});
+		}
+		TSharedRef<FJsonObject> Skin = MakeShared<FJsonObject>();
+		Skin->SetArrayField(TEXT("joints"), Joints);
+		Skin->SetNumberField(TEXT("skeleton"), 1);
+		Skin->SetNumberField(TEXT("inverseBindMatrices"), Writer.AddAccessor(InverseBindMatrices, GltfFloat, Bones, TEXT("MAT4"), 0));
+		Root->SetArrayField(TEXT("skins"), {MakeShared<FJsonValueObject>(Skin)});
+		SceneNodes.Add(MakeShared<FJsonValueNumber>(1));
+	}
+	Nodes.Insert(MakeShared<FJsonValueObject>(MeshNode), 0);
+
+	TSharedRef<FJsonObject> Asset = MakeShared<FJsonObject>();
+	Asset->SetStringField(TEXT("version"), TEXT("2.0"));
+	Asset->SetStringField(TEXT("generator"), TEXT("AssetsBridge corpus generator"));
+	TSharedRef<FJsonObject> Scene = MakeShared<FJsonObject>();
+	Scene->SetArrayField(TEXT("nodes"), SceneNodes);
+	Root->SetObjectField(TEXT("asset"), Asset);
+	Root->SetNumberField(TEXT("scene"), 0);
+	Root->SetArrayField(TEXT("scenes"), {MakeShared<FJsonValueObject>(Scene)});
+	Root->SetArrayField(TEXT("nodes"), Nodes);
+	Root->SetArrayField(TEXT("meshes"), {MakeShared<FJsonValueObject>(Mesh)});
+	Root->SetArrayField(TEXT("materials"), Materials);
+	Writer.Finish(Root, OutBytes);
+}
+
+/** Writes one PNG of a baked texture set with content typical for its role. */
+static bool WriteCorpusTexture(FRandomStream& Stream, int32 Size, const TCHAR* Role, const FString& FilePath)
+{
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(Size * Size);
+	const FColor TintA = FColor::MakeRandomSeededColor(static_cast<int32>(Stream.GetUnsignedInt()));
+	const FColor TintB = FColor::MakeRandomSeededColor(static_cast<int32>(Stream.GetUnsignedInt()));
+	const uint8 Roughness = static_cast<uint8>(Stream.RandRange(32, 224));
+	const uint8 Metallic = Stream.FRand() < 0.3f ? 255 : 0;
+	const int32 Cell = FMath::Max(1, Size / 8);
+	for (int32 Y = 0; Y < Size; Y++)
+	{
+		for (int32 X = 0; X < Size; X++)
+		{
+			const bool bChecker = ((X / Cell) + (Y / Cell)) % 2 == 0;
+			FColor& Pixel = Pixels[Y * Size + X];
+			if (FCString::Strcmp(Role, TEXT("BaseColor")) == 0)
+			{
+				Pixel = bChecker ? TintA : TintB;
+			}
+			else if (FCString::Strcmp(Role, TEXT("ORM")) == 0)
+			{
+				Pixel = FColor(bChecker ? 255 : 200, Roughness, Metallic);
+			}
+			else if (FCString::Strcmp(Role, TEXT("Normal")) == 0)
+			{
+				Pixel = FColor(bChecker ? 128 : 150, 128, 255);
+			}
+			else
+			{
+				Pixel = bChecker && X < Size / 2 && Y < Size / 2 ? TintA : FColor::Black;
+			}
+			Pixel.A = 255;
+		}
+	}
+	TArray64<uint8> Png;
+	FImageUtils::PNGCompressImageArray(Size, Size, TArrayView64<const FColor>(Pixels.GetData(), Pixels.Num()), Png);
+	return FFileHelper::SaveArrayToFile(Png, *FilePath);
+}
+
+void UBridgeCorpusGenerator::GenerateCorpus(const FBridgeCorpusOptions& Options, bool& bIsSuccessful, FString& OutMessage)
+{
+	if (Options.OutputDir.IsEmpty())
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("No output directory given for the corpus");
+		return;
+	}
+
+	// One stream for the whole corpus: every value depends only on the seed and the options
+	FRandomStream Stream(Options.Seed);
+	FString ContentRoot = Options.ContentPath;
+	ContentRoot.RemoveFromEnd(TEXT("/"));
+	FString InternalRoot = ContentRoot;
+	InternalRoot.RemoveFromStart(TEXT("/Game"));
+
+	const int32 NumItems = Options.StaticMeshes + Options.SkeletalMeshes;
+	const int32 TextureEvery = Options.TextureSets > 0 ? FMath::Max(1, NumItems / Options.TextureSets) : 0;
+	int32 NumTextureSets = 0;
+	int64 NumBytes = 0;
+	FString SharedSkeleton = Options.SkeletonPath;
+
+	FBridgeExport Manifest;
+	Manifest.Operation = "BlenderExport";
+	TArray<uint8> Glb;
+	for (int32 Index = 0; Index < NumItems; Index++)
+	{
+		const bool bSkeletal = Index >= Options.StaticMeshes;
+		const FString Folder = bSkeletal ? TEXT("Skeletal") : TEXT("Static");
+		const FString Name = FString::Printf(TEXT("%s_Corpus_%05d"), bSkeletal ? TEXT("SK") : TEXT("SM"), Index);
+
+		FExportAsset Item;
+		Item.ObjectID = FString::Printf(TEXT("corpus-%d-%05d"), Options.Seed, Index);
+		Item.Model = FString::Printf(TEXT("%s/%s/%s.%s"), *ContentRoot, *Folder, *Name, *Name);
+		Item.ShortName = Name;
+		Item.InternalPath = InternalRoot / Folder;
+		Item.RelativeExportPath = Item.InternalPath;
+		Item.ExportLocation = FPaths::Combine(Options.OutputDir, Folder, Name + TEXT(".glb"));
+		Item.StringType = bSkeletal ? TEXT("SkeletalMesh") : TEXT("StaticMesh");
+		if (bSkeletal)
+		{
+			if (SharedSkeleton.IsEmpty())
+			{
+				// Interchange names the skeleton it generates for the first mesh <Mesh>_Skeleton
+				SharedSkeleton = FString::Printf(TEXT("%s/%s/%s_Skeleton.%s_Skeleton"), *ContentRoot, *Folder, *Name, *Name);
+			}
+			else
+			{
+				Item.Skeleton = SharedSkeleton;
+			}
+			for (int32 Morph = 0; Morph < Options.MorphTargets; Morph++)
+			{
+				Item.MorphTargets.Add(FString::Printf(TEXT("Morph_%03d"), Morph));
+				if (GetCorpusMorphKind(Morph) == ECorpusMorph::KeptEmpty)
+				{
+					Item.KeepEmptyMorphTargets.Add(Item.MorphTargets.Last());
+				}
+			}
+		}
+
+		// Slots are unchanged (existing material) or added in Blender; some meshes also dropped one
+		const int32 NumSlots = Stream.RandRange(1, FMath::Max(1, Options.MaxMaterialSlots));
+		TArray<FString> SlotNames;
+		for (int32 Slot = 0; Slot < NumSlots; Slot++)
+		{
+			FMaterialSlot MaterialSlot;
+			MaterialSlot.Idx = Slot;
+			if (Slot == 0 || Stream.FRand() < 0.7f)
+			{
+				MaterialSlot.Name = FString::Printf(TEXT("Slot_%d"), Slot);
+				MaterialSlot.InternalPath = CorpusMaterialPath;
+				MaterialSlot.OriginalIdx = Slot;
+				Item.MaterialChangeset.Unchanged.Add(MaterialSlot);
+			}
+			else
+			{
+				MaterialSlot.Name = FString::Printf(TEXT("Added_%d"), Slot);
+				Item.MaterialChangeset.Added.Add(MaterialSlot);
+			}
+			Item.ObjectMaterials.Add(MaterialSlot);
+			SlotNames.Add(MaterialSlot.Name);
+		}
+		if (Stream.FRand() < 0.2f)
+		{
+			FMaterialSlot Removed;
+			Removed.Name = TEXT("Removed");
+			Removed.Idx = -1;
+			Removed.OriginalIdx = NumSlots;
+			Removed.InternalPath = CorpusMaterialPath;
+			Item.MaterialChangeset.Removed.Add(Removed);
+		}
+
+		BuildStripGlb(Stream, Options.Triangles, bSkeletal ? Options.Bones : 0, Options.MorphTargets, SlotNames, Glb);
+		if (!FFileHelper::SaveArrayToFile(Glb, *Item.ExportLocation))
+		{
+			bIsSuccessful = false;
+			OutMessage = FString::Printf(TEXT("Could not write %s"), *Item.ExportLocation);
+			return;
+		}
+		NumBytes += Glb.Num();
+
+		if (TextureEvery > 0 && NumTextureSets < Options.TextureSets && Index % TextureEvery == 0)
+		{
+			const FString TextureDir = FPaths::Combine(Options.OutputDir, Folder, TEXT("Textures"));
+			const FString TextureContentPath = ContentRoot / Folder / TEXT("Textures");
+			const TPair<const TCHAR*, FBridgeTexture*> Roles[] = {
+				{TEXT("BaseColor"), &Item.Textures.BaseColor}, {TEXT("ORM"), &Item.Textures.Orm},
+				{TEXT("Normal"), &Item.Textures.Normal}, {TEXT("Emissive"), &Item.Textures.Emissive}
+			};
+			for (const TPair<const TCHAR*, FBridgeTexture*>& Role : Roles)
+			{
+				Role.Value->File = FPaths::Combine(TextureDir, FString::Printf(TEXT("T_%s_%s.png"), *Name, Role.Key));
+				Role.Value->ContentPath = TextureContentPath;
+				if (!WriteCorpusTexture(Stream, Options.TextureSize, Role.Key, Role.Value->File))
+				{
+					bIsSuccessful = false;
+					OutMessage = FString::Printf(TEXT("Could not write %s"), *Role.Value->File);
+					return;
+				}
+				NumBytes += IFileManager::Get().FileSize(*Role.Value->File);
+			}
+			NumTextureSets++;
+		}
+		Manifest.Objects.Add(MoveTemp(Item));
+	}
+
+	UAssetsBridgeTools::WriteBridgeExportFileAt(Manifest, FPaths::Combine(Options.OutputDir, TEXT("from-blender.json")), bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		return;
+	}
+	OutMessage = FString::Printf(TEXT("Generated %d static and %d skeletal mesh(es) with %d texture set(s), %.1f MB, seed %d, in %s"),
+	                             Options.StaticMeshes, Options.SkeletalMeshes, NumTextureSets, NumBytes / (1024.0 * 1024.0),
+	                             Options.Seed, *Options.OutputDir);
+	UE_LOG(LogAssetsBridge, Display, TEXT("%s"), *OutMessage);
+}
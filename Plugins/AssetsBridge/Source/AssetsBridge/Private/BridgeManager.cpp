@@ -3,26 +3,46 @@
 
 #include "BridgeManager.h"
 
+#include "AssetsBridge.h"
+#include "BridgeStats.h"
+
+#include "ABSettings.h"
 #include "AssetsBridgeTools.h"
 #include "PBRMaterialBuilder.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "ActorFactories/ActorFactory.h"
 #include "ActorFactories/ActorFactoryBlueprint.h"
+#include "Engine/Blueprint.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "PackageTools.h"
+#include "ObjectTools.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
 #include "Animation/Skeleton.h"
 #include "Animation/MorphTarget.h"
+#include "MeshDescription.h"
+#include "SkeletalMeshAttributes.h"
 #include "Exporters/Exporter.h"
 #include "Materials/MaterialInstance.h"
+#include "Engine/Texture.h"
 #include "Editor/UnrealEd/Public/AssetImportTask.h"
 #include "AssetToolsModule.h"
 #include "AutomatedAssetImportData.h"
 #include "Subsystems/EditorActorSubsystem.h"
 // Export task for automated export
 #include "AssetExportTask.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/MetaData.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+// Parallel export workers
+#include "BridgeManifest.h"
+#include "BridgeSkeletonIndex.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
 // Physics asset for retargeting
 #include "PhysicsEngine/PhysicsAsset.h"
 // For skeleton compatibility check
@@ -31,6 +51,456 @@
 #include "EngineUtils.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+// Asynchronous import polling and progress
+#include "Containers/Ticker.h"
+#include "UObject/GCObject.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+// Source fingerprints for skipping unchanged imports
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "IO/IoHash.h"
+#include "SkinnedAssetCompiler.h"
+#include "InterchangeManager.h"
+#include "InterchangeGenericAssetsPipeline.h"
+#include "InterchangeGenericAssetsPipelineSharedSettings.h"
+#include "InterchangeGenericMeshPipeline.h"
+#include "BridgeMorphPrunePipeline.h"
+
+/**
+ * The jobs of an import run. Keeps the import tasks and their results referenced while batches are
+ * submitted and waited on, so a garbage collection in between cannot collect them.
+ */
+class FBridgeImportJobSet : public FGCObject
+{
+public:
+	TArray<FBridgeImportJob> Jobs;
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+	{
+		for (FBridgeImportJob& Job : Jobs)
+		{
+			Collector.AddReferencedObject(Job.Task);
+			Collector.AddReferencedObject(Job.ImportedAsset);
+			Collector.AddReferencedObjects(Job.TaskPipelines);
+		}
+	}
+
+	virtual FString GetReferencerName() const override
+	{
+		return TEXT("FBridgeImportJobSet");
+	}
+};
+
+/** State of an in-flight asynchronous import, alive until the ticker has finalized every item. */
+class FBridgeAsyncImport : public FBridgeImportJobSet
+{
+public:
+	/** Parallel to Jobs, true once the item has been resolved and finalized */
+	TArray<bool> Finished;
+
+	int32 NumFinished = 0;
+
+	FOnBridgeImportComplete OnComplete;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	TSharedPtr<SNotificationItem> Notification;
+
+	/** Materials restored by FinalizeImportJob, loading while the mesh tasks run */
+	TSharedPtr<FStreamableHandle> MaterialPreload;
+
+	/** Baked textures importing alongside the mesh tasks, resolved before the first item is finalized */
+	FBridgeJobTextures Textures;
+
+	virtual FString GetReferencerName() const override
+	{
+		return TEXT("FBridgeAsyncImport");
+	}
+};
+
+static TSharedPtr<FBridgeAsyncImport> GActiveAsyncImport;
+
+// Time the async import may spend finalizing items per editor frame
+static constexpr double GAsyncImportFrameBudgetSeconds = 0.01;
+
+/** glTF exporter classes resolved by GetGLTFExporterClass. */
+struct FGLTFExporterClassCache
+{
+	TWeakObjectPtr<UClass> StaticMeshExporter;
+	TWeakObjectPtr<UClass> SkeletalMeshExporter;
+	bool bResolved = false;
+	FDelegateHandle ModulesChangedHandle;
+};
+
+static FGLTFExporterClassCache GGLTFExporterClasses;
+
+/** Finds a concrete exporter class by name, by path first and by scanning loaded classes as a fallback. */
+static UClass* FindExporterClass(const TCHAR* ClassPath, const TCHAR* ClassName)
+{
+	if (UClass* Found = FindObject<UClass>(nullptr, ClassPath))
+	{
+		return Found;
+	}
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(UExporter::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract) && It->GetName().Contains(ClassName))
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+// Starting an editor process takes a while, so small exports are always done in process
+static constexpr int32 GMinParallelExportItems = 16;
+
+const FName UBridgeManager::SourceFingerprintTag(TEXT("AssetsBridge.SourceFingerprint"));
+
+void UBridgeManager::RegisterAssetRegistryTags()
+{
+	UMetaData::GetMetaDataTagsForAssetRegistry().Add(SourceFingerprintTag);
+}
+
+/** Every file on disk an item is built from: the .glb plus any baked textures. */
+static TArray<FString> GetImportSourceFiles(const FExportAsset& Item)
+{
+	TArray<FString> Files;
+	Files.Add(Item.ExportLocation);
+	for (const FBridgeTexture* Tex : {&Item.Textures.BaseColor, &Item.Textures.Orm, &Item.Textures.Normal, &Item.Textures.Emissive})
+	{
+		if (!Tex->File.IsEmpty())
+		{
+			Files.Add(Tex->File);
+		}
+	}
+	return Files;
+}
+
+/** Object path of the material restored into an unchanged slot; manifests may omit the /Game mount point. */
+static FString GetRestoredMaterialPath(const FMaterialSlot& Slot)
+{
+	FString MaterialPath = Slot.InternalPath;
+	if (!MaterialPath.StartsWith(TEXT("/Game")) && !MaterialPath.StartsWith(TEXT("/Engine")))
+	{
+		MaterialPath = TEXT("/Game") + MaterialPath;
+	}
+	return MaterialPath;
+}
+
+/**
+ * Shape key names the Blender exporter stores in mesh extras.targetNames, in glTF morph target order.
+ * Returns an empty array when the file has none (e.g. exports from older addon versions).
+ */
+static TArray<FString> ReadGltfMorphTargetNames(const FString& FilePath)
+{
+	TArray<FString> Names;
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	const TSharedPtr<FJsonObject> Gltf = UAssetsBridgeTools::ReadGltfJson(FilePath, bIsSuccessful, OutMessage);
+	const TArray<TSharedPtr<FJsonValue>>* Meshes = nullptr;
+	if (!bIsSuccessful || !Gltf->TryGetArrayField(TEXT("meshes"), Meshes))
+	{
+		return Names;
+	}
+	// Meshes of one skeletal mesh share their morph targets, which are merged by name on import
+	for (const TSharedPtr<FJsonValue>& Mesh : *Meshes)
+	{
+		const TSharedPtr<FJsonObject>* Extras = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* TargetNames = nullptr;
+		if (Mesh->AsObject()->TryGetObjectField(TEXT("extras"), Extras) && (*Extras)->TryGetArrayField(TEXT("targetNames"), TargetNames))
+		{
+			for (const TSharedPtr<FJsonValue>& Name : *TargetNames)
+			{
+				// Case sensitive, so names that only differ in case reach BuildMorphTargetRenames and get reported
+				const FString TargetName = Name->AsString();
+				if (!Names.ContainsByPredicate([&TargetName](const FString& Existing) { return Existing.Equals(TargetName, ESearchCase::CaseSensitive); }))
+				{
+					Names.Add(TargetName);
+				}
+			}
+		}
+	}
+	return Names;
+}
+
+/** Moves a morph target's position (and normal) deltas in a mesh description to a new attribute name. */
+static void MoveMorphTargetAttribute(FMeshDescription& MeshDescription, FSkeletalMeshAttributes& Attributes, const FName From, const FName To)
+{
+	const bool bHasNormals = Attributes.HasMorphTargetNormalsAttribute(From);
+	Attributes.RegisterMorphTargetAttribute(To, bHasNormals);
+	TVertexAttributesRef<FVector3f> FromPositions = Attributes.GetVertexMorphPositionDelta(From);
+	TVertexAttributesRef<FVector3f> ToPositions = Attributes.GetVertexMorphPositionDelta(To);
+	for (const FVertexID VertexID : MeshDescription.Vertices().GetElementIDs())
+	{
+		ToPositions.Set(VertexID, FromPositions.Get(VertexID));
+	}
+	if (bHasNormals)
+	{
+		TVertexInstanceAttributesRef<FVector3f> FromNormals = Attributes.GetVertexInstanceMorphNormalDelta(From);
+		TVertexInstanceAttributesRef<FVector3f> ToNormals = Attributes.GetVertexInstanceMorphNormalDelta(To);
+		for (const FVertexInstanceID InstanceID : MeshDescription.VertexInstances().GetElementIDs())
+		{
+			ToNormals.Set(InstanceID, FromNormals.Get(InstanceID));
+		}
+	}
+	Attributes.UnregisterMorphTargetAttribute(From);
+}
+
+/**
+ * Renames morph targets in the source mesh descriptions of every LOD, which the built morph targets are
+ * generated from, so a rebuild of the mesh keeps the names. Goes through temporary names like the objects.
+ */
+static void RenameSourceMorphTargets(USkeletalMesh* Mesh, const TArray<TPair<FName, FName>>& Renames)
+{
+	for (int32 LODIdx = 0; LODIdx < Mesh->GetLODNum(); LODIdx++)
+	{
+		FMeshDescription* MeshDescription = Mesh->GetMeshDescription(LODIdx);
+		if (!MeshDescription)
+		{
+			continue;
+		}
+		FSkeletalMeshAttributes Attributes(*MeshDescription);
+		const TArray<FName> MorphNames = Attributes.GetMorphTargetNames();
+		TArray<TPair<FName, FName>> Moves;
+		for (const TPair<FName, FName>& Rename : Renames)
+		{
+			if (MorphNames.Contains(Rename.Key))
+			{
+				const FName TempName(*FString::Printf(TEXT("MorphRename_%d"), Moves.Num()));
+				MoveMorphTargetAttribute(*MeshDescription, Attributes, Rename.Key, TempName);
+				Moves.Emplace(TempName, Rename.Value);
+			}
+		}
+		for (const TPair<FName, FName>& Move : Moves)
+		{
+			MoveMorphTargetAttribute(*MeshDescription, Attributes, Move.Key, Move.Value);
+		}
+		if (Moves.Num() > 0)
+		{
+			Mesh->CommitMeshDescription(LODIdx);
+		}
+	}
+}
+
+/** Manifest fields that change the post-import result even when the source files are identical. */
+static FString GetImportSettingsKey(const FExportAsset& Item)
+{
+	FString Key = Item.StringType + TEXT("|") + Item.Skeleton + TEXT("|") + FString::Join(Item.MorphTargets, TEXT(","))
+		+ TEXT("|") + FString::Join(Item.KeepEmptyMorphTargets, TEXT(","));
+	for (const FMaterialSlot& Slot : Item.MaterialChangeset.Unchanged)
+	{
+		Key += FString::Printf(TEXT("|%d=%s"), Slot.Idx, *Slot.InternalPath);
+	}
+	Key += TEXT("|") + Item.Textures.Master + TEXT("|") + Item.Textures.MaterialInstance;
+	return Key;
+}
+
+/** Cheap size/modification time stamp of the source files, compared before falling back to hashing. */
+static FString GetImportSourceStamp(const TArray<FString>& Files)
+{
+	FString Stamp;
+	for (const FString& File : Files)
+	{
+		const int64 Size = IFileManager::Get().FileSize(*File);
+		const int64 Ticks = IFileManager::Get().GetTimeStamp(*File).GetTicks();
+		Stamp += FString::Printf(TEXT("%lld:%lld;"), Size, Ticks);
+	}
+	return Stamp;
+}
+
+/** Content hash of the source files. Returns an empty string if a file cannot be read. */
+static FString GetImportSourceHash(const TArray<FString>& Files)
+{
+	FXxHash64Builder Builder;
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(1024 * 1024);
+	for (const FString& File : Files)
+	{
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*File));
+		if (!Reader)
+		{
+			return FString();
+		}
+		int64 Remaining = Reader->TotalSize();
+		while (Remaining > 0)
+		{
+			const int64 ToRead = FMath::Min<int64>(Remaining, Chunk.Num());
+			Reader->Serialize(Chunk.GetData(), ToRead);
+			Builder.Update(Chunk.GetData(), ToRead);
+			Remaining -= ToRead;
+		}
+	}
+	return FString::Printf(TEXT("%016llx"), Builder.Finalize().Hash);
+}
+
+/**
+ * Assets other than the mesh itself that end up in its exported .glb: its materials with their parent
+ * chains, the textures those use and the skeleton.
+ */
+static TArray<const UObject*> GetExportDependencies(const FExportAsset& Item)
+{
+	TArray<UMaterialInterface*> Materials;
+	const USkeleton* Skeleton = nullptr;
+	if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Item.ModelPtr))
+	{
+		for (const FStaticMaterial& Mat : StaticMesh->GetStaticMaterials())
+		{
+			Materials.Add(Mat.MaterialInterface);
+		}
+	}
+	else if (const USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Item.ModelPtr))
+	{
+		for (const FSkeletalMaterial& Mat : SkeletalMesh->GetMaterials())
+		{
+			Materials.Add(Mat.MaterialInterface);
+		}
+		Skeleton = SkeletalMesh->GetSkeleton();
+	}
+
+	TArray<const UObject*> Dependencies;
+	TArray<UTexture*> Textures;
+	for (UMaterialInterface* Material : Materials)
+	{
+		if (!Material)
+		{
+			// Keeps an empty slot visible in the fingerprint
+			Dependencies.Add(nullptr);
+			continue;
+		}
+		for (const UMaterialInterface* Link = Material; Link; )
+		{
+			Dependencies.AddUnique(Link);
+			const UMaterialInstance* Instance = Cast<UMaterialInstance>(Link);
+			Link = Instance ? Instance->Parent.Get() : nullptr;
+		}
+		TArray<UTexture*> UsedTextures;
+		Material->GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num, true, ERHIFeatureLevel::Num, true);
+		for (UTexture* Texture : UsedTextures)
+		{
+			Textures.AddUnique(Texture);
+		}
+	}
+	// The fingerprint depends on the order, which should not change when a material is recompiled
+	Textures.Sort([](const UTexture& A, const UTexture& B) { return A.GetPathName() < B.GetPathName(); });
+	Dependencies.Append(Textures);
+	Dependencies.Add(Skeleton);
+	return Dependencies;
+}
+
+/**
+ * The glTF exporter settings every .glb is written with, read from the options class default object
+ * (which holds the project's saved options) without linking against the exporter module.
+ */
+static FString GetGLTFExportOptionsKey()
+{
+	const UClass* OptionsClass = FindObject<UClass>(nullptr, TEXT("/Script/GLTFExporter.GLTFExportOptions"));
+	if (!OptionsClass)
+	{
+		return FString(TEXT("none"));
+	}
+	const UObject* Options = OptionsClass->GetDefaultObject();
+	FString Key;
+	for (TFieldIterator<FProperty> It(OptionsClass); It; ++It)
+	{
+		FString Value;
+		It->ExportTextItem_InContainer(Value, Options, nullptr, nullptr, PPF_None);
+		Key += It->GetName() + TEXT("=") + Value + TEXT(";");
+	}
+	return FString::Printf(TEXT("%016llx"), FXxHash64::HashBuffer(*Key, Key.Len() * sizeof(TCHAR)).Hash);
+}
+
+/** True when the mesh or any of its export dependencies has edits that are not saved to disk yet. */
+static bool HasUnsavedExportChanges(const FExportAsset& Item)
+{
+	const UPackage* Package = Item.ModelPtr ? Item.ModelPtr->GetPackage() : nullptr;
+	if (!Package || Package->IsDirty() || !FPackageName::DoesPackageExist(Package->GetName()))
+	{
+		return true;
+	}
+	for (const UObject* Dependency : GetExportDependencies(Item))
+	{
+		const UPackage* DependencyPackage = Dependency ? Dependency->GetPackage() : nullptr;
+		if (DependencyPackage && DependencyPackage->IsDirty())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Saved state of the package an exported .glb is built from, plus its export dependencies and the exporter
+ * settings (InOptionsKey, see GetGLTFExportOptionsKey). Empty when the asset has unsaved changes.
+ */
+static FString GetExportFingerprint(const FExportAsset& Item, const FString& InOptionsKey)
+{
+	const UPackage* Package = Item.ModelPtr ? Item.ModelPtr->GetPackage() : nullptr;
+	if (!Package || Package->IsDirty() || Package->GetSavedHash().IsZero())
+	{
+		return FString();
+	}
+
+	FString Fingerprint = InOptionsKey + TEXT("|") + LexToString(Package->GetSavedHash());
+	for (const UObject* Dependency : GetExportDependencies(Item))
+	{
+		const UPackage* DependencyPackage = Dependency ? Dependency->GetPackage() : nullptr;
+		if (DependencyPackage && DependencyPackage->IsDirty())
+		{
+			return FString();
+		}
+		Fingerprint += TEXT("|") + (DependencyPackage ? LexToString(DependencyPackage->GetSavedHash()) : FString(TEXT("none")));
+	}
+	return Fingerprint;
+}
+
+/** The export cache lives in the bridge directory next to the exported files. */
+static FString GetExportCachePath()
+{
+	FString AssetBase;
+	UAssetsBridgeTools::GetExportRoot(AssetBase);
+	return FPaths::Combine(AssetBase, TEXT("export-cache.json"));
+}
+
+/** ExportLocation -> "<fingerprint>#<.glb stamp>" of the last export written to that file. */
+static TMap<FString, FString> LoadExportCache()
+{
+	TMap<FString, FString> Cache;
+	const FString CachePath = GetExportCachePath();
+	if (!IFileManager::Get().FileExists(*CachePath))
+	{
+		return Cache;
+	}
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	TSharedPtr<FJsonObject> CacheObject = UAssetsBridgeTools::ReadJson(CachePath, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful || !CacheObject.IsValid())
+	{
+		UE_LOG(LogAssetsBridge, Warning, TEXT("Ignoring unreadable export cache: %s"), *OutMessage);
+		return Cache;
+	}
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : CacheObject->Values)
+	{
+		Cache.Add(Entry.Key, Entry.Value->AsString());
+	}
+	return Cache;
+}
+
+static void SaveExportCache(const TMap<FString, FString>& Cache)
+{
+	TSharedPtr<FJsonObject> CacheObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FString>& Entry : Cache)
+	{
+		CacheObject->SetStringField(Entry.Key, Entry.Value);
+	}
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	UAssetsBridgeTools::WriteJson(GetExportCachePath(), CacheObject, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		UE_LOG(LogAssetsBridge, Warning, TEXT("Could not save export cache: %s"), *OutMessage);
+	}
+}
 
 UBridgeManager::UBridgeManager()
 {
@@ -219,7 +689,7 @@ void UBridgeManager::StartExport(bool& bIsSuccessful, FString& OutMessage)
 			AActor* ItemActor = Cast<AActor>(SelItem.WorldObject);
 			if (ItemActor)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Found this to be an actual world actor"))
+				UE_LOG(LogAssetsBridge, Warning, TEXT("Found this to be an actual world actor"))
 				FRotator Rotator = ItemActor->GetActorTransform().GetRotation().Rotator();
 				FWorldData ActorWorldInfo;
 				ActorWorldInfo.Location = ItemActor->GetActorLocation();
@@ -257,7 +727,7 @@ void UBridgeManager::StartExport(bool& bIsSuccessful, FString& OutMessage)
 		{
 			// Create a formatted FString
 			FString InternalPath = FString::Printf(TEXT("/Game%s/%s"), *ExItem.InternalPath, *ExItem.ShortName);
-			UE_LOG(LogTemp, Warning, TEXT("Exporting %s to %s"), *InternalPath, *ExItem.ExportLocation);
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Exporting %s to %s"), *InternalPath, *ExItem.ExportLocation);
 			ExportObject(InternalPath, ExItem.ExportLocation, bIsSuccessful, OutMessage);
 			if (!bIsSuccessful)
 			{
@@ -271,25 +741,168 @@ void UBridgeManager::StartExport(bool& bIsSuccessful, FString& OutMessage)
 
 void UBridgeManager::GenerateExport(TArray<FExportAsset> MeshDataArray, bool& bIsSuccessful, FString& OutMessage)
 {
+	FBridgeOperationScope OperationScope(TEXT("Export"));
 	FBridgeExport ExportData;
 	ExportData.Operation = "UnrealExport";
+
+	TArray<bool> Exported;
+	int32 NumExported = 0;
+	int32 NumReused = 0;
+	ExportAssetsIncremental(MeshDataArray, Exported, NumExported, NumReused, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		return;
+	}
+
+	// Selection order is kept so the manifest is the same no matter where each item was exported
+	for (int32 Idx = 0; Idx < MeshDataArray.Num(); Idx++)
+	{
+		if (Exported[Idx])
+		{
+			ExportData.Objects.Add(MeshDataArray[Idx]);
+		}
+	}
 	
-	// Find the glTF exporter class
-	UClass* GLTFExporterClass = nullptr;
-	for (TObjectIterator<UClass> It; It; ++It)
+	UAssetsBridgeTools::WriteBridgeExportFile(ExportData, bIsSuccessful, OutMessage);
+	if (bIsSuccessful)
 	{
-		if (It->IsChildOf(UExporter::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract))
+		OutMessage += FString::Printf(TEXT(" (exported %d, reused %d unchanged)"), NumExported, NumReused);
+	}
+}
+
+void UBridgeManager::ExportAssetsIncremental(const TArray<FExportAsset>& MeshDataArray, TArray<bool>& OutExported,
+                                             int32& OutNumExported, int32& OutNumReused, bool& bIsSuccessful, FString& OutMessage)
+{
+	OutExported.Init(false, MeshDataArray.Num());
+	OutNumExported = 0;
+	OutNumReused = 0;
+
+	// A .glb can be reused when neither the asset nor the file changed since it was written
+	const UABSettings* Settings = GetDefault<UABSettings>();
+	TMap<FString, FString> ExportCache = LoadExportCache();
+	const FString OptionsKey = GetGLTFExportOptionsKey();
+	TArray<FString> Fingerprints;
+	Fingerprints.SetNum(MeshDataArray.Num());
+	TArray<bool> Reused;
+	Reused.Init(false, MeshDataArray.Num());
+	for (int32 Idx = 0; Idx < MeshDataArray.Num(); Idx++)
+	{
+		const FExportAsset& Item = MeshDataArray[Idx];
+		Fingerprints[Idx] = GetExportFingerprint(Item, OptionsKey);
+		if (!Settings->bSkipUnchangedExports || Fingerprints[Idx].IsEmpty() || !IFileManager::Get().FileExists(*Item.ExportLocation))
+		{
+			continue;
+		}
+		const FString* Cached = ExportCache.Find(Item.ExportLocation);
+		if (Cached && *Cached == Fingerprints[Idx] + TEXT("#") + GetImportSourceStamp({Item.ExportLocation}))
+		{
+			OutExported[Idx] = true;
+			Reused[Idx] = true;
+			OutNumReused++;
+		}
+	}
+
+	// Workers load packages from disk, so anything with unsaved edits, in the mesh or in an asset it is
+	// exported with, has to be exported by this editor
+	const int32 NumWorkers = Settings->ParallelExportWorkers;
+	TArray<int32> WorkerItems;
+	TArray<int32> LocalItems;
+	for (int32 Idx = 0; Idx < MeshDataArray.Num(); Idx++)
+	{
+		if (Reused[Idx])
+		{
+			continue;
+		}
+		if (NumWorkers > 0 && !HasUnsavedExportChanges(MeshDataArray[Idx]))
+		{
+			WorkerItems.Add(Idx);
+		}
+		else
+		{
+			LocalItems.Add(Idx);
+		}
+	}
+	if (WorkerItems.Num() < GMinParallelExportItems)
+	{
+		LocalItems.Append(WorkerItems);
+		WorkerItems.Reset();
+	}
+
+	if (WorkerItems.Num() > 0)
+	{
+		ExportAssetItemsInWorkers(MeshDataArray, WorkerItems, NumWorkers, OutExported);
+		// Anything a worker did not produce is retried here
+		for (int32 Idx : WorkerItems)
 		{
-			FString ClassName = It->GetName();
-			if (ClassName.Contains(TEXT("GLTFStaticMeshExporter")) || ClassName.Contains(TEXT("GLTFSkeletalMeshExporter")))
+			if (!OutExported[Idx])
 			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Found glTF exporter class: %s"), *ClassName);
+				LocalItems.Add(Idx);
 			}
 		}
 	}
-	
-	for (auto Item : MeshDataArray)
+	LocalItems.Sort();
+
+	ExportAssetItems(MeshDataArray, LocalItems, OutExported, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		return;
+	}
+
+	for (int32 Idx = 0; Idx < MeshDataArray.Num(); Idx++)
 	{
+		if (OutExported[Idx] && !Reused[Idx])
+		{
+			OutNumExported++;
+			const FString& ExportLocation = MeshDataArray[Idx].ExportLocation;
+			if (Fingerprints[Idx].IsEmpty())
+			{
+				ExportCache.Remove(ExportLocation);
+			}
+			else
+			{
+				ExportCache.Add(ExportLocation, Fingerprints[Idx] + TEXT("#") + GetImportSourceStamp({ExportLocation}));
+			}
+		}
+	}
+	if (OutNumExported > 0)
+	{
+		SaveExportCache(ExportCache);
+	}
+	OutMessage = FString::Printf(TEXT("Exported %d, reused %d unchanged"), OutNumExported, OutNumReused);
+}
+
+void UBridgeManager::ExportAssetItems(const TArray<FExportAsset>& Items, const TArray<int32>& ItemIndices, TArray<bool>& OutExported,
+                                      bool& bIsSuccessful, FString& OutMessage)
+{
+	// Walking every loaded class is expensive, only do it when diagnosing exporter lookups
+	if (GetDefault<UABSettings>()->bVerboseLogging)
+	{
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			if (It->IsChildOf(UExporter::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract))
+			{
+				FString ClassName = It->GetName();
+				if (ClassName.Contains(TEXT("GLTFStaticMeshExporter")) || ClassName.Contains(TEXT("GLTFSkeletalMeshExporter")))
+				{
+					UE_LOG(LogAssetsBridge, Log, TEXT("Found glTF exporter class: %s"), *ClassName);
+				}
+			}
+		}
+	}
+
+	// One exporter per class and a single export task are shared by every item in this batch
+	TMap<UClass*, TStrongObjectPtr<UExporter>> Exporters;
+	TStrongObjectPtr<UAssetExportTask> ExportTask(NewObject<UAssetExportTask>());
+	ExportTask->bSelected = false;
+	ExportTask->bReplaceIdentical = true;
+	ExportTask->bPrompt = false;
+	ExportTask->bAutomated = true;
+	ExportTask->bUseFileArchive = false;
+	ExportTask->bWriteEmptyFiles = false;
+	
+	for (int32 ItemIdx : ItemIndices)
+	{
+		const FExportAsset& Item = Items[ItemIdx];
 		bool bDidExport = false;
 		
 		// Create the destination directory if it doesn't already exist
@@ -299,7 +912,7 @@ void UBridgeManager::GenerateExport(TArray<FExportAsset> MeshDataArray, bool& bI
 			const bool bTree = true;
 			if (!IFileManager::Get().MakeDirectory(*ItemPath, bTree))
 			{
-				UE_LOG(LogTemp, Error, TEXT("%s. The destination directory could not be created."), *ItemPath);
+				UE_LOG(LogAssetsBridge, Error, TEXT("%s. The destination directory could not be created."), *ItemPath);
 				bIsSuccessful = false;
 				OutMessage = FString::Printf(TEXT("%s. The destination directory could not be created."), *ItemPath);
 				return;
@@ -314,7 +927,7 @@ void UBridgeManager::GenerateExport(TArray<FExportAsset> MeshDataArray, bool& bI
 		{
 			ObjectToExport = Mesh;
 			ExporterClassName = TEXT("GLTFStaticMeshExporter");
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Preparing to export static mesh %s to glTF: %s"), *Mesh->GetName(), *Item.ExportLocation);
+			UE_LOG(LogAssetsBridge, Log, TEXT("Preparing to export static mesh %s to glTF: %s"), *Mesh->GetName(), *Item.ExportLocation);
 		}
 		
 		USkeletalMesh* SkeleMesh = Cast<USkeletalMesh>(Item.ModelPtr);
@@ -329,386 +942,1116 @@ void UBridgeManager::GenerateExport(TArray<FExportAsset> MeshDataArray, bool& bI
 			{
 				const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
 				int32 NumBones = RefSkeleton.GetNum();
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge Export: Mesh %s uses skeleton %s with %d total bones"), 
+				UE_LOG(LogAssetsBridge, Log, TEXT("Mesh %s uses skeleton %s with %d total bones"), 
 					*SkeleMesh->GetName(), *Skeleton->GetName(), NumBones);
 			}
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Preparing to export skeletal mesh %s to glTF: %s"), *SkeleMesh->GetName(), *Item.ExportLocation);
+			UE_LOG(LogAssetsBridge, Log, TEXT("Preparing to export skeletal mesh %s to glTF: %s"), *SkeleMesh->GetName(), *Item.ExportLocation);
 		}
 		
 		if (ObjectToExport)
 		{
 			// Find the appropriate glTF exporter
 			UExporter* Exporter = nullptr;
-			for (TObjectIterator<UClass> It; It; ++It)
+			if (UClass* ExporterClass = GetGLTFExporterClass(SkeleMesh != nullptr))
 			{
-				if (It->IsChildOf(UExporter::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract))
+				TStrongObjectPtr<UExporter>& CachedExporter = Exporters.FindOrAdd(ExporterClass);
+				if (!CachedExporter.IsValid())
 				{
-					if (It->GetName().Contains(ExporterClassName))
-					{
-						Exporter = NewObject<UExporter>(GetTransientPackage(), *It);
-						break;
-					}
+					CachedExporter.Reset(NewObject<UExporter>(GetTransientPackage(), ExporterClass));
 				}
+				Exporter = CachedExporter.Get();
 			}
 			
 			if (Exporter)
 			{
 				// Use UAssetExportTask for automated export
-				UAssetExportTask* ExportTask = NewObject<UAssetExportTask>();
 				ExportTask->Object = ObjectToExport;
 				ExportTask->Exporter = Exporter;
 				ExportTask->Filename = Item.ExportLocation;
-				ExportTask->bSelected = false;
-				ExportTask->bReplaceIdentical = true;
-				ExportTask->bPrompt = false;
-				ExportTask->bAutomated = true;
-				ExportTask->bUseFileArchive = false;
-				ExportTask->bWriteEmptyFiles = false;
+				ExportTask->Errors.Reset();
 				
-				bool bExportSuccess = UExporter::RunAssetExportTask(ExportTask);
+				bool bExportSuccess;
+				{
+					BRIDGE_STAGE_SCOPE("glTF Export");
+					bExportSuccess = UExporter::RunAssetExportTask(ExportTask.Get());
+				}
 				
 				if (bExportSuccess)
 				{
 					bDidExport = true;
-					UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Successfully exported %s"), *ObjectToExport->GetName());
+					UE_LOG(LogAssetsBridge, Log, TEXT("Successfully exported %s"), *ObjectToExport->GetName());
 				}
 				else
 				{
-					UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Failed to export %s"), *ObjectToExport->GetName());
+					UE_LOG(LogAssetsBridge, Warning, TEXT("Failed to export %s"), *ObjectToExport->GetName());
 				}
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("AssetsBridge: Could not find glTF exporter for %s"), *ExporterClassName);
+				UE_LOG(LogAssetsBridge, Error, TEXT("Could not find glTF exporter for %s"), *ExporterClassName);
 			}
 		}
 		
-		if (bDidExport)
-		{
-			ExportData.Objects.Add(Item);
-		}
+		OutExported[ItemIdx] = bDidExport;
 	}
-	
-	UAssetsBridgeTools::WriteBridgeExportFile(ExportData, bIsSuccessful, OutMessage);
+	bIsSuccessful = true;
+	OutMessage = FString::Printf(TEXT("Exported %d asset(s)"), ItemIndices.Num());
 }
 
+void UBridgeManager::ExportAssetItemsInWorkers(const TArray<FExportAsset>& Items, const TArray<int32>& ItemIndices, int32 NumWorkers,
+                                               TArray<bool>& OutExported)
+{
+	BRIDGE_STAGE_SCOPE("Export Workers");
+	struct FExportWorker
+	{
+		TArray<int32> ItemIndices;
+		FString InputFile;
+		FString OutputFile;
+		FProcHandle Process;
+	};
+
+	const FString WorkDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir() / TEXT("AssetsBridge"));
+	IFileManager::Get().MakeDirectory(*WorkDir, true);
+	const FString EditorPath = FPlatformProcess::ExecutablePath();
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+	// Round robin so every worker gets a similar mix of small and large assets
+	TArray<FExportWorker> Workers;
+	Workers.SetNum(FMath::Min(NumWorkers, ItemIndices.Num()));
+	for (int32 Idx = 0; Idx < ItemIndices.Num(); Idx++)
+	{
+		Workers[Idx % Workers.Num()].ItemIndices.Add(ItemIndices[Idx]);
+	}
+
+	for (int32 WorkerIdx = 0; WorkerIdx < Workers.Num(); WorkerIdx++)
+	{
+		FExportWorker& Worker = Workers[WorkerIdx];
+		Worker.InputFile = WorkDir / FString::Printf(TEXT("ExportWorker%d.in"), WorkerIdx);
+		Worker.OutputFile = WorkDir / FString::Printf(TEXT("ExportWorker%d.out"), WorkerIdx);
+		IFileManager::Get().Delete(*Worker.OutputFile, false, true, true);
+
+		FBridgeExport WorkerData;
+		for (int32 ItemIdx : Worker.ItemIndices)
+		{
+			WorkerData.Objects.Add(Items[ItemIdx]);
+		}
+		TArray<uint8> Bytes;
+		UBridgeManifest::WriteBinary(WorkerData, Bytes);
+		if (!FFileHelper::SaveArrayToFile(Bytes, *Worker.InputFile))
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Could not write export worker input %s"), *Worker.InputFile);
+			continue;
+		}
+
+		// Rendering stays available (offscreen) since the glTF exporter may bake materials
+		const FString Params = FString::Printf(
+			TEXT("\"%s\" -run=AssetsBridgeExport -Input=\"%s\" -Output=\"%s\" -unattended -nopause -nosplash -RenderOffscreen -stdout"),
+			*ProjectPath, *Worker.InputFile, *Worker.OutputFile);
+		Worker.Process = FPlatformProcess::CreateProc(*EditorPath, *Params, true, true, true, nullptr, 0, nullptr, nullptr);
+		if (!Worker.Process.IsValid())
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Could not start export worker %d"), WorkerIdx);
+		}
+	}
+
+	FScopedSlowTask SlowTask(Workers.Num(), FText::FromString(
+		FString::Printf(TEXT("Exporting %d asset(s) with %d worker(s)..."), ItemIndices.Num(), Workers.Num())));
+	SlowTask.MakeDialog(true);
+	for (FExportWorker& Worker : Workers)
+	{
+		while (Worker.Process.IsValid() && FPlatformProcess::IsProcRunning(Worker.Process))
+		{
+			if (SlowTask.ShouldCancel())
+			{
+				FPlatformProcess::TerminateProc(Worker.Process, true);
+				break;
+			}
+			FPlatformProcess::Sleep(0.1f);
+			SlowTask.TickProgress();
+		}
+		SlowTask.EnterProgressFrame();
+
+		if (Worker.Process.IsValid())
+		{
+			FPlatformProcess::CloseProc(Worker.Process);
+		}
+
+		// Items are matched by destination file; anything missing is left for the in-process retry
+		bool bReadOutput = false;
+		FString ReadMessage;
+		FBridgeExport WorkerResult;
+		if (IFileManager::Get().FileExists(*Worker.OutputFile))
+		{
+			UBridgeManifest::ReadFile(Worker.OutputFile, WorkerResult, bReadOutput, ReadMessage);
+		}
+		TSet<FString> ExportedFiles;
+		for (const FExportAsset& Item : WorkerResult.Objects)
+		{
+			ExportedFiles.Add(Item.ExportLocation);
+		}
+		int32 NumExported = 0;
+		for (int32 ItemIdx : Worker.ItemIndices)
+		{
+			OutExported[ItemIdx] = ExportedFiles.Contains(Items[ItemIdx].ExportLocation);
+			NumExported += OutExported[ItemIdx] ? 1 : 0;
+		}
+		UE_LOG(LogAssetsBridge, Log, TEXT("Export worker finished %d of %d asset(s)"), NumExported, Worker.ItemIndices.Num());
+
+		IFileManager::Get().Delete(*Worker.InputFile, false, true, true);
+		IFileManager::Get().Delete(*Worker.OutputFile, false, true, true);
+	}
+}
+
+
+UClass* UBridgeManager::GetGLTFExporterClass(bool bSkeletalMesh)
+{
+	if (!GGLTFExporterClasses.ModulesChangedHandle.IsValid())
+	{
+		// A plugin being loaded, unloaded or live coded can add, remove or replace the exporter classes
+		GGLTFExporterClasses.ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda(
+			[](FName, EModuleChangeReason)
+			{
+				GGLTFExporterClasses.bResolved = false;
+			});
+	}
+
+	const bool bStale = (GGLTFExporterClasses.StaticMeshExporter.IsStale() || GGLTFExporterClasses.SkeletalMeshExporter.IsStale());
+	if (!GGLTFExporterClasses.bResolved || bStale)
+	{
+		GGLTFExporterClasses.StaticMeshExporter = FindExporterClass(
+			TEXT("/Script/GLTFExporter.GLTFStaticMeshExporter"), TEXT("GLTFStaticMeshExporter"));
+		GGLTFExporterClasses.SkeletalMeshExporter = FindExporterClass(
+			TEXT("/Script/GLTFExporter.GLTFSkeletalMeshExporter"), TEXT("GLTFSkeletalMeshExporter"));
+		GGLTFExporterClasses.bResolved = true;
+	}
+	return bSkeletalMesh ? GGLTFExporterClasses.SkeletalMeshExporter.Get() : GGLTFExporterClasses.StaticMeshExporter.Get();
+}
 
 void UBridgeManager::GenerateImport(bool& bIsSuccessful, FString& OutMessage)
 {
-	UE_LOG(LogTemp, Warning, TEXT("Starting import"))
-	FBridgeExport BridgeData = UAssetsBridgeTools::ReadBridgeExportFile(bIsSuccessful, OutMessage);
+	GenerateImportWithOptions(FBridgeImportOptions(), bIsSuccessful, OutMessage);
+}
+
+void UBridgeManager::GenerateImportWithOptions(const FBridgeImportOptions& Options, bool& bIsSuccessful, FString& OutMessage)
+{
+	TArray<FBridgeImportItemResult> Results;
+	GenerateImportWithResults(Options, Results, bIsSuccessful, OutMessage);
+}
+
+void UBridgeManager::GenerateImportWithResults(const FBridgeImportOptions& Options, TArray<FBridgeImportItemResult>& OutResults,
+                                               bool& bIsSuccessful, FString& OutMessage)
+{
+	OutResults.Reset();
+	// Both would write the same destination assets
+	if (IsImportInProgress())
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("An asynchronous import is in progress");
+		return;
+	}
+
+	FBridgeOperationScope OperationScope(TEXT("Import"));
+	UE_LOG(LogAssetsBridge, Warning, TEXT("Starting import"))
+	FBridgeExport BridgeData = ReadImportManifest(Options, bIsSuccessful, OutMessage);
 	if (!bIsSuccessful)
 	{
 		return;
 	}
 
-	for (auto Item : BridgeData.Objects)
+	// Build every import task up front so they can be handed to Interchange together
+	FBridgeImportJobSet JobSet;
+	TArray<FBridgeImportJob>& Jobs = JobSet.Jobs;
+	Jobs.SetNum(BridgeData.Objects.Num());
+	for (int32 Idx = 0; Idx < BridgeData.Objects.Num(); Idx++)
 	{
-		// Try to extract original asset name from 'Model' field which contains the full path
-		// Format: "/Script/Engine.SkeletalMesh'/Game/Path/AssetName.AssetName'" or "/Game/Path/AssetName.AssetName"
-		FString OriginalName = Item.ShortName;
-		if (!Item.Model.IsEmpty())
+		PrepareImportJob(BridgeData.Objects[Idx], Options, Jobs[Idx]);
+	}
+
+	ResolveJobSkeletons(Jobs);
+
+	// Batch size of 1 keeps the original one-task-per-call behavior
+	const UABSettings* Settings = GetDefault<UABSettings>();
+	TSharedPtr<FStreamableHandle> MaterialPreload = PreloadRestoredMaterials(Jobs);
+	SubmitImportJobs(Jobs, Settings->bBatchImport ? Settings->ImportBatchSize : 1);
+	ImportJobTextures(Jobs, Settings->bBatchImport ? Settings->ImportBatchSize : 1);
+	if (MaterialPreload.IsValid())
+	{
+		BRIDGE_STAGE_SCOPE("Material Preload");
+		MaterialPreload->WaitUntilComplete();
+	}
+
+	for (FBridgeImportJob& Job : Jobs)
+	{
+		if (Job.Result.bIsSuccessful && Job.ImportedAsset)
 		{
-			// Extract asset name from model path
-			FString ModelPathStr = Item.Model;
-			int32 LastSlash = ModelPathStr.Find(TEXT("/"), ESearchCase::IgnoreCase, ESearchDir::FromEnd);
-			int32 FirstDot = ModelPathStr.Find(TEXT("."), ESearchCase::IgnoreCase, ESearchDir::FromStart, LastSlash);
-			if (LastSlash != INDEX_NONE && FirstDot != INDEX_NONE)
+			FinalizeImportJob(Job);
+		}
+	}
+	RetargetMatchedSkeletons(Jobs);
+	RefreshWorldMeshUsers(Jobs);
+
+	for (const FBridgeImportJob& Job : Jobs)
+	{
+		OutResults.Add(Job.Result);
+	}
+	SummarizeImportJobs(Jobs, bIsSuccessful, OutMessage);
+}
+
+FBridgeExport UBridgeManager::ReadImportManifest(const FBridgeImportOptions& Options, bool& bIsSuccessful, FString& OutMessage)
+{
+	FBridgeExport BridgeData = Options.ManifestPath.IsEmpty()
+		                           ? UAssetsBridgeTools::ReadBridgeExportFile(bIsSuccessful, OutMessage)
+		                           : UAssetsBridgeTools::ReadBridgeExportFileAt(Options.ManifestPath, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful || Options.ShardCount <= 1)
+	{
+		return BridgeData;
+	}
+	if (Options.ShardIndex < 0 || Options.ShardIndex >= Options.ShardCount)
+	{
+		bIsSuccessful = false;
+		OutMessage = FString::Printf(TEXT("Shard %d is out of range for %d shard(s)"), Options.ShardIndex, Options.ShardCount);
+		return FBridgeExport();
+	}
+
+	TArray<FExportAsset> ShardObjects;
+	for (int32 Idx = Options.ShardIndex; Idx < BridgeData.Objects.Num(); Idx += Options.ShardCount)
+	{
+		ShardObjects.Add(MoveTemp(BridgeData.Objects[Idx]));
+	}
+	BridgeData.Objects = MoveTemp(ShardObjects);
+	return BridgeData;
+}
+
+void UBridgeManager::GenerateImportAsync(const FBridgeImportOptions& Options, const FOnBridgeImportComplete& OnComplete,
+                                         bool& bIsSuccessful, FString& OutMessage)
+{
+	if (IsImportInProgress())
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("An import is already in progress");
+		return;
+	}
+
+	UE_LOG(LogAssetsBridge, Log, TEXT("Starting async import"));
+	// Ended by TickAsyncImport once every item has been finalized
+	FBridgeStats::BeginOperation(TEXT("Async Import"));
+	FBridgeExport BridgeData = ReadImportManifest(Options, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		FBridgeStats::EndOperation();
+		return;
+	}
+
+	TSharedPtr<FBridgeAsyncImport> Import = MakeShared<FBridgeAsyncImport>();
+	Import->OnComplete = OnComplete;
+	Import->Jobs.SetNum(BridgeData.Objects.Num());
+	Import->Finished.Init(false, BridgeData.Objects.Num());
+	for (int32 Idx = 0; Idx < BridgeData.Objects.Num(); Idx++)
+	{
+		PrepareImportJob(BridgeData.Objects[Idx], Options, Import->Jobs[Idx]);
+	}
+	ResolveJobSkeletons(Import->Jobs);
+
+	FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("Importing %d object(s)..."), Import->Jobs.Num())));
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.ExpireDuration = 3.0f;
+	if (!UAssetsBridgeTools::IsUnattended())
+	{
+		Import->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	}
+	if (Import->Notification.IsValid())
+	{
+		Import->Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	GActiveAsyncImport = Import;
+	const UABSettings* Settings = GetDefault<UABSettings>();
+	SubmitJobTextures(Import->Jobs, Settings->bBatchImport ? Settings->ImportBatchSize : 1, true, Import->Textures);
+	Import->MaterialPreload = PreloadRestoredMaterials(Import->Jobs);
+	SubmitImportJobs(Import->Jobs, Settings->bBatchImport ? Settings->ImportBatchSize : 1, true);
+	Import->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateStatic(&UBridgeManager::TickAsyncImport));
+
+	bIsSuccessful = true;
+	OutMessage = FString::Printf(TEXT("Started importing %d object(s)"), Import->Jobs.Num());
+}
+
+FBridgeOperationStats UBridgeManager::GetLastOperationStats()
+{
+	return FBridgeStats::GetLastOperation();
+}
+
+bool UBridgeManager::IsImportInProgress()
+{
+	return GActiveAsyncImport.IsValid();
+}
+
+bool UBridgeManager::TickAsyncImport(float DeltaTime)
+{
+	TSharedPtr<FBridgeAsyncImport> Import = GActiveAsyncImport;
+	if (!Import.IsValid())
+	{
+		return false;
+	}
+
+	// Finalizing restores the preloaded materials, so wait for them rather than loading them one by one
+	if (Import->MaterialPreload.IsValid() && !Import->MaterialPreload->HasLoadCompleted())
+	{
+		return true;
+	}
+
+	// Finalizing builds the material instances from the baked textures, so those have to be in first
+	if (!Import->Textures.bResolved)
+	{
+		if (!Import->Textures.Batch.IsImportComplete())
+		{
+			return true;
+		}
+		ResolveJobTextures(Import->Jobs, Import->Textures);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < Import->Jobs.Num(); Idx++)
+	{
+		if (Import->Finished[Idx])
+		{
+			continue;
+		}
+		FBridgeImportJob& Job = Import->Jobs[Idx];
+		// Jobs without a task failed during preparation and only need to be counted
+		if (Job.Task)
+		{
+			if (!Job.Task->IsAsyncImportComplete())
 			{
-				OriginalName = ModelPathStr.Mid(LastSlash + 1, FirstDot - LastSlash - 1);
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Extracted original name '%s' from ModelPath"), *OriginalName);
+				continue;
+			}
+			Job.ImportedAsset = ResolveImportTask(Job.Task, Job.Result.bIsSuccessful, Job.Result.Message);
+			if (Job.Result.bIsSuccessful && Job.ImportedAsset)
+			{
+				FinalizeImportJob(Job);
 			}
 		}
-		
-		// Normalize the internal path
-		FString NormalizedPath = Item.InternalPath;
-		
-		// Remove any /Game or /Content prefix if included
-		NormalizedPath.RemoveFromStart(TEXT("/Game"));
-		NormalizedPath.RemoveFromStart(TEXT("Game"));
-		NormalizedPath.RemoveFromStart(TEXT("/Content"));
-		NormalizedPath.RemoveFromStart(TEXT("Content"));
-		
-		// Ensure leading slash
-		if (!NormalizedPath.StartsWith("/"))
+		Import->Finished[Idx] = true;
+		Import->NumFinished++;
+
+		if (FPlatformTime::Seconds() - StartTime > GAsyncImportFrameBudgetSeconds)
 		{
-			NormalizedPath = "/" + NormalizedPath;
+			break;
 		}
-		
-		// Fix doubled path segments (e.g., /Assets/Assets/ -> /Assets/)
-		TArray<FString> PathSegments;
-		NormalizedPath.ParseIntoArray(PathSegments, TEXT("/"), true);
-		if (PathSegments.Num() >= 2 && PathSegments[0] == PathSegments[1])
+	}
+
+	if (Import->NumFinished < Import->Jobs.Num())
+	{
+		if (Import->Notification.IsValid())
 		{
-			PathSegments.RemoveAt(0);
-			NormalizedPath = "/" + FString::Join(PathSegments, TEXT("/"));
-			UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Fixed doubled path segment, normalized to: %s"), *NormalizedPath);
+			Import->Notification->SetText(FText::FromString(
+				FString::Printf(TEXT("Importing... %d of %d object(s) done"), Import->NumFinished, Import->Jobs.Num())));
 		}
-		
-		FString ImportPackageName = FString("/Game") + NormalizedPath + FString("/") + OriginalName;
-		ImportPackageName = UPackageTools::SanitizePackageName(ImportPackageName);
-		bool bHasExisting = false;
-		FString ExistingName;
-		if (HasExistingPackageAtPath(ImportPackageName))
-		{
-			UStaticMesh* ExistingMesh = FindObject<UStaticMesh>(nullptr, *ImportPackageName);
-			if (ExistingMesh != nullptr)
+		return true;
+	}
+
+	RetargetMatchedSkeletons(Import->Jobs);
+	RefreshWorldMeshUsers(Import->Jobs);
+
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	SummarizeImportJobs(Import->Jobs, bIsSuccessful, OutMessage);
+	if (Import->Notification.IsValid())
+	{
+		Import->Notification->SetText(FText::FromString(OutMessage));
+		Import->Notification->SetCompletionState(bIsSuccessful ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		Import->Notification->ExpireAndFadeout();
+	}
+
+	TArray<FBridgeImportItemResult> Results;
+	for (const FBridgeImportJob& Job : Import->Jobs)
+	{
+		Results.Add(Job.Result);
+	}
+
+	// Clear the active import before notifying so the callback can chain another import
+	GActiveAsyncImport.Reset();
+	FBridgeStats::EndOperation();
+	Import->OnComplete.ExecuteIfBound(bIsSuccessful, OutMessage, Results);
+	return false;
+}
+
+TSharedPtr<FStreamableHandle> UBridgeManager::PreloadRestoredMaterials(const TArray<FBridgeImportJob>& Jobs)
+{
+	if (!UAssetManager::IsInitialized())
+	{
+		return nullptr;
+	}
+	TSet<FSoftObjectPath> Unique;
+	TArray<FSoftObjectPath> Paths;
+	for (const FBridgeImportJob& Job : Jobs)
+	{
+		// Items with a baked texture set get a generated material instance instead of the restore
+		if (!Job.Task || Job.Item.HasTextures())
+		{
+			continue;
+		}
+		for (const FMaterialSlot& Slot : Job.Item.MaterialChangeset.Unchanged)
+		{
+			const FSoftObjectPath Path(GetRestoredMaterialPath(Slot));
+			bool bAlreadyAdded = false;
+			Unique.Add(Path, &bAlreadyAdded);
+			// Loaded materials need no request
+			if (!bAlreadyAdded && Path.IsValid() && !Path.ResolveObject())
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Found existing mesh, closing all related editors"))
-				GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(ExistingMesh);
+				Paths.Add(Path);
 			}
-
-			bHasExisting = true;
 		}
-		UObject* ImportedAsset = ImportAsset(Item.ExportLocation, ImportPackageName, Item.StringType, Item.Skeleton, bIsSuccessful, OutMessage);
-		if (!bIsSuccessful)
+	}
+	if (Paths.Num() == 0)
+	{
+		return nullptr;
+	}
+	UE_LOG(LogAssetsBridge, Log, TEXT("Preloading %d restored material(s)"), Paths.Num());
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UBridgeManager::RetargetMatchedSkeletons(const TArray<FBridgeImportJob>& Jobs)
+{
+	TArray<FSkeletonImportResult> Retargets;
+	TArray<USkeletalMesh*> Meshes;
+	for (const FBridgeImportJob& Job : Jobs)
+	{
+		USkeletalMesh* SkeletalMesh = Job.Result.bIsSuccessful ? Cast<USkeletalMesh>(Job.ImportedAsset) : nullptr;
+		if (!SkeletalMesh)
 		{
-			return;
+			continue;
 		}
-		
-		// Relocate asset if Interchange created it in a subfolder structure
-		if (ImportedAsset)
+		Meshes.Add(SkeletalMesh);
+		if (!Job.MatchedSkeletonPath.IsEmpty())
 		{
-			bool bRelocateSuccess = false;
-			FString RelocateMessage;
-			UObject* RelocatedAsset = RelocateImportedAsset(ImportedAsset, ImportPackageName, bRelocateSuccess, RelocateMessage);
-			if (bRelocateSuccess && RelocatedAsset)
+			FSkeletonImportResult Analysis = AnalyzeSkeletalMeshImport(SkeletalMesh, Job.MatchedSkeletonPath);
+			if (Analysis.bNewSkeletonGenerated)
 			{
-				ImportedAsset = RelocatedAsset;
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: %s"), *RelocateMessage);
+				Retargets.Add(MoveTemp(Analysis));
 			}
-			else if (!bRelocateSuccess)
+		}
+	}
+	if (Retargets.Num() > 0)
+	{
+		bool bRetargeted = false;
+		FString RetargetMessage;
+		RetargetSkeletalMeshesToSkeleton(Retargets, true, bRetargeted, RetargetMessage);
+		UE_LOG(LogAssetsBridge, Log, TEXT("Compatible skeletons: %s"), *RetargetMessage);
+	}
+	// Keep the index current for the skeletons this import created (not saved yet) and the tagged ones it may
+	// have extended; untagged existing skeletons are left to TagUntaggedSkeletons instead of being dirtied here
+	for (USkeletalMesh* SkeletalMesh : Meshes)
+	{
+		USkeleton* Skeleton = SkeletalMesh->GetSkeleton();
+		if (Skeleton && (!FPackageName::DoesPackageExist(Skeleton->GetPackage()->GetName()) ||
+		                 !UEditorAssetLibrary::GetMetadataTag(Skeleton, UBridgeSkeletonIndex::FingerprintTag).IsEmpty()))
+		{
+			UBridgeSkeletonIndex::TagSkeleton(Skeleton);
+		}
+	}
+}
+
+/**
+ * Appends a UBridgeMorphPrunePipeline to the task's pipeline stack, so the morph targets are pruned before the
+ * mesh is first built. Tasks without a stack get the project's import stack for the file to append to.
+ */
+static void AddMorphPrunePipeline(UAssetImportTask* Task, const FExportAsset& Item, float Threshold)
+{
+	UInterchangePipelineStackOverride* Stack = Cast<UInterchangePipelineStackOverride>(Task->Options);
+	if (!Stack)
+	{
+		Stack = NewObject<UInterchangePipelineStackOverride>();
+		Stack->OverridePipelines = UAssetsBridgeTools::GetProjectImportPipelines(Task->Filename);
+		if (Stack->OverridePipelines.Num() == 0)
+		{
+			Stack->AddPipeline(NewObject<UInterchangeGenericAssetsPipeline>());
+		}
+		Task->Options = Stack;
+	}
+	UBridgeMorphPrunePipeline* Pipeline = NewObject<UBridgeMorphPrunePipeline>();
+	Pipeline->Threshold = Threshold;
+	Pipeline->KeepNames = Item.KeepEmptyMorphTargets;
+	Stack->AddPipeline(Pipeline);
+}
+
+void UBridgeManager::ResolveJobSkeletons(TArray<FBridgeImportJob>& Jobs)
+{
+	TOptional<FBridgeSkeletonIndex> Index;
+	for (FBridgeImportJob& Job : Jobs)
+	{
+		if (!Job.Task || !Job.Item.StringType.Equals(TEXT("SkeletalMesh"), ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+		// Tasks CreateImportTask already pointed at a skeleton (manifest or existing mesh) need no lookup
+		if (Job.Task->Options)
+		{
+			continue;
+		}
+
+		TArray<FBridgeBoneLink> Bones;
+		bool bReadBones = false;
+		FString ReadMessage;
+		UBridgeSkeletonIndex::ReadGltfBones(Job.Item.ExportLocation, Bones, bReadBones, ReadMessage);
+		if (!bReadBones || Bones.Num() == 0)
+		{
+			continue;
+		}
+		// Built on first use so runs without skeletal meshes never scan the registry
+		if (!Index.IsSet())
+		{
+			Index = FBridgeSkeletonIndex::Build();
+		}
+		const FSoftObjectPath Match = Index->FindCompatible(Bones);
+		if (Match.IsValid())
+		{
+			Job.MatchedSkeletonPath = Match.ToString();
+			UE_LOG(LogAssetsBridge, Log, TEXT("%s matches existing skeleton %s"), *Job.ImportPackageName, *Job.MatchedSkeletonPath);
+			// Matched meshes used to end up without a physics asset after the retarget; keep it that way
+			ConfigureSkeletalImportPipeline(Job.Task, Job.MatchedSkeletonPath, nullptr, false);
+		}
+	}
+
+	const UABSettings* Settings = GetDefault<UABSettings>();
+	for (FBridgeImportJob& Job : Jobs)
+	{
+		if (Job.Task)
+		{
+			if (Settings->bPruneMorphTargets && Job.Item.MorphTargets.Num() > 0
+				&& Job.Item.StringType.Equals(TEXT("SkeletalMesh"), ESearchCase::IgnoreCase))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Relocation issue: %s"), *RelocateMessage);
-				// Continue with original asset even if relocation failed
+				AddMorphPrunePipeline(Job.Task, Job.Item, Settings->MorphTargetPruneThreshold);
 			}
+			Job.TaskPipelines.Append(UAssetsBridgeTools::GetStackPipelines(Cast<UInterchangePipelineStackOverride>(Job.Task->Options)));
 		}
-		
-		// Restore morph target names for skeletal meshes
-		if (Item.StringType == "SkeletalMesh" && Item.MorphTargets.Num() > 0 && ImportedAsset)
+	}
+}
+
+void UBridgeManager::PrepareImportJob(const FExportAsset& InItem, const FBridgeImportOptions& Options, FBridgeImportJob& OutJob)
+{
+	OutJob.Item = InItem;
+	OutJob.Result.SourceFile = InItem.ExportLocation;
+
+	// Try to extract original asset name from 'Model' field which contains the full path
+	// Format: "/Script/Engine.SkeletalMesh'/Game/Path/AssetName.AssetName'" or "/Game/Path/AssetName.AssetName"
+	OutJob.OriginalName = InItem.ShortName;
+	if (!InItem.Model.IsEmpty())
+	{
+		// Extract asset name from model path
+		FString ModelPathStr = InItem.Model;
+		int32 LastSlash = ModelPathStr.Find(TEXT("/"), ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+		int32 FirstDot = ModelPathStr.Find(TEXT("."), ESearchCase::IgnoreCase, ESearchDir::FromStart, LastSlash);
+		if (LastSlash != INDEX_NONE && FirstDot != INDEX_NONE)
+		{
+			OutJob.OriginalName = ModelPathStr.Mid(LastSlash + 1, FirstDot - LastSlash - 1);
+			UE_LOG(LogAssetsBridge, Log, TEXT("Extracted original name '%s' from ModelPath"), *OutJob.OriginalName);
+		}
+	}
+	
+	// Normalize the internal path
+	FString NormalizedPath = InItem.InternalPath;
+	
+	// Remove any /Game or /Content prefix if included
+	NormalizedPath.RemoveFromStart(TEXT("/Game"));
+	NormalizedPath.RemoveFromStart(TEXT("Game"));
+	NormalizedPath.RemoveFromStart(TEXT("/Content"));
+	NormalizedPath.RemoveFromStart(TEXT("Content"));
+	
+	// Ensure leading slash
+	if (!NormalizedPath.StartsWith("/"))
+	{
+		NormalizedPath = "/" + NormalizedPath;
+	}
+	
+	// Fix doubled path segments (e.g., /Assets/Assets/ -> /Assets/)
+	TArray<FString> PathSegments;
+	NormalizedPath.ParseIntoArray(PathSegments, TEXT("/"), true);
+	if (PathSegments.Num() >= 2 && PathSegments[0] == PathSegments[1])
+	{
+		PathSegments.RemoveAt(0);
+		NormalizedPath = "/" + FString::Join(PathSegments, TEXT("/"));
+		UE_LOG(LogAssetsBridge, Warning, TEXT("Fixed doubled path segment, normalized to: %s"), *NormalizedPath);
+	}
+	
+	OutJob.ImportPackageName = FString("/Game") + NormalizedPath + FString("/") + OutJob.OriginalName;
+	OutJob.ImportPackageName = UPackageTools::SanitizePackageName(OutJob.ImportPackageName);
+	if (HasExistingPackageAtPath(OutJob.ImportPackageName))
+	{
+		UStaticMesh* ExistingMesh = FindObject<UStaticMesh>(nullptr, *OutJob.ImportPackageName);
+		if (ExistingMesh != nullptr)
 		{
-			USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(ImportedAsset);
-			if (SkeletalMesh)
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Found existing mesh, closing all related editors"))
+			GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(ExistingMesh);
+		}
+	}
+
+	OutJob.Result.PackageName = OutJob.ImportPackageName;
+	// The fingerprint is always computed so a forced import still records it for the next run
+	const bool bUpToDate = IsImportUpToDate(OutJob);
+	if (bUpToDate && !Options.bForceReimport && GetDefault<UABSettings>()->bSkipUnchangedImports)
+	{
+		UE_LOG(LogAssetsBridge, Log, TEXT("Source unchanged, skipping import of %s"), *OutJob.ImportPackageName);
+		OutJob.Result.bIsSuccessful = true;
+		OutJob.Result.bSkipped = true;
+		OutJob.Result.Message = TEXT("Source unchanged since last import");
+		return;
+	}
+
+	OutJob.Task = CreateImportTask(InItem.ExportLocation, OutJob.ImportPackageName, InItem.StringType, InItem.Skeleton,
+	                               OutJob.Result.bIsSuccessful, OutJob.Result.Message);
+	if (!OutJob.Result.bIsSuccessful)
+	{
+		OutJob.Task = nullptr;
+	}
+}
+
+bool UBridgeManager::IsImportUpToDate(FBridgeImportJob& Job)
+{
+	BRIDGE_STAGE_SCOPE("Change Detection");
+	const TArray<FString> Files = GetImportSourceFiles(Job.Item);
+	const FString Stamp = GetImportSourceStamp(Files);
+	const FString SettingsKey = GetImportSettingsKey(Job.Item);
+	const FString SettingsHash = FString::Printf(TEXT("%016llx"),
+		FXxHash64::HashBuffer(*SettingsKey, SettingsKey.Len() * sizeof(TCHAR)).Hash);
+
+	// Read without loading anything: from the asset itself only when it is already in memory (its tag may
+	// not be saved yet), otherwise from the asset registry, which sees the tag once the asset was saved
+	FString Recorded;
+	const FString ObjectPath = Job.ImportPackageName + TEXT(".") + FPackageName::GetShortName(Job.ImportPackageName);
+	if (UObject* Loaded = FindObject<UObject>(nullptr, *ObjectPath))
+	{
+		Recorded = UEditorAssetLibrary::GetMetadataTag(Loaded, SourceFingerprintTag);
+	}
+	else
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		const FAssetData Existing = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath), true);
+		if (Existing.IsValid())
+		{
+			Existing.GetTagValue(SourceFingerprintTag, Recorded);
+		}
+	}
+
+	// Fingerprint format: "<size:mtime;...>|<settings hash>|<content hash>"
+	TArray<FString> RecordedParts;
+	Recorded.ParseIntoArray(RecordedParts, TEXT("|"), false);
+	const bool bHasRecord = RecordedParts.Num() == 3;
+	const bool bSettingsMatch = bHasRecord && RecordedParts[1] == SettingsHash;
+
+	// Same size and timestamp on every file means nothing was rewritten, so hashing can be skipped
+	if (bSettingsMatch && RecordedParts[0] == Stamp)
+	{
+		Job.SourceFingerprint = Recorded;
+		return true;
+	}
+
+	const FString ContentHash = GetImportSourceHash(Files);
+	Job.SourceFingerprint = FString::Join(TArray<FString>{Stamp, SettingsHash, ContentHash}, TEXT("|"));
+	return bSettingsMatch && !ContentHash.IsEmpty() && RecordedParts[2] == ContentHash;
+}
+
+void UBridgeManager::SubmitImportJobs(TArray<FBridgeImportJob>& Jobs, int32 InBatchSize, bool bInAsync)
+{
+	BRIDGE_STAGE_SCOPE("Import Task");
+	TArray<FBridgeImportJob*> Pending;
+	for (FBridgeImportJob& Job : Jobs)
+	{
+		if (Job.Task)
+		{
+			Pending.Add(&Job);
+		}
+	}
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+	const int32 BatchSize = InBatchSize > 0 ? InBatchSize : Pending.Num();
+	for (int32 Start = 0; Start < Pending.Num(); Start += BatchSize)
+	{
+		const int32 End = FMath::Min(Start + BatchSize, Pending.Num());
+		TArray<UAssetImportTask*> BatchTasks;
+		BatchTasks.Reserve(End - Start);
+		for (int32 Idx = Start; Idx < End; Idx++)
+		{
+			Pending[Idx]->Task->bAsync = bInAsync;
+			BatchTasks.Add(Pending[Idx]->Task);
+		}
+
+		UE_LOG(LogAssetsBridge, Log, TEXT("Submitting import tasks %d-%d of %d"), Start + 1, End, Pending.Num());
+		AssetToolsModule.Get().ImportAssetTasks(BatchTasks);
+		if (bInAsync)
+		{
+			continue;
+		}
+
+		for (int32 Idx = Start; Idx < End; Idx++)
+		{
+			FBridgeImportJob& Job = *Pending[Idx];
+			Job.ImportedAsset = ResolveImportTask(Job.Task, Job.Result.bIsSuccessful, Job.Result.Message);
+		}
+	}
+}
+
+void UBridgeManager::ImportJobTextures(TArray<FBridgeImportJob>& Jobs, int32 InBatchSize)
+{
+	FBridgeJobTextures Textures;
+	SubmitJobTextures(Jobs, InBatchSize, false, Textures);
+	ResolveJobTextures(Jobs, Textures);
+}
+
+void UBridgeManager::SubmitJobTextures(const TArray<FBridgeImportJob>& Jobs, int32 InBatchSize, bool bInAsync, FBridgeJobTextures& OutTextures)
+{
+	TArray<FPBRTextureImport>& Requests = OutTextures.Requests;
+	TArray<int32>& FirstRequests = OutTextures.FirstRequests;
+	TArray<int32>& NumRequests = OutTextures.NumRequests;
+	FirstRequests.Init(INDEX_NONE, Jobs.Num());
+	NumRequests.Init(0, Jobs.Num());
+	for (int32 Idx = 0; Idx < Jobs.Num(); Idx++)
+	{
+		// Jobs without a task were skipped or failed; async meshes are still importing and get their textures regardless
+		const FBridgeImportJob& Job = Jobs[Idx];
+		if (Job.Task && Job.Item.HasTextures() && (bInAsync || (Job.Result.bIsSuccessful && Job.ImportedAsset)))
+		{
+			// Same folder FinalizeImportJob falls back to once the mesh is relocated to its package
+			const FString FallbackTexDir = FPackageName::GetLongPackagePath(Job.ImportPackageName) / TEXT("Textures");
+			FirstRequests[Idx] = UPBRMaterialBuilder::AddTextureSetImports(Job.Item.Textures, FallbackTexDir, Requests);
+			NumRequests[Idx] = Requests.Num() - FirstRequests[Idx];
+		}
+	}
+	if (Requests.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogAssetsBridge, Log, TEXT("Importing %d baked texture(s) for the run"), Requests.Num());
+	UPBRMaterialBuilder::SubmitTextureImports(Requests, InBatchSize, bInAsync, OutTextures.Batch);
+}
+
+void UBridgeManager::ResolveJobTextures(TArray<FBridgeImportJob>& Jobs, FBridgeJobTextures& Textures)
+{
+	Textures.bResolved = true;
+	if (Textures.Requests.Num() == 0)
+	{
+		return;
+	}
+	UPBRMaterialBuilder::ResolveTextureImports(Textures.Requests, Textures.Batch);
+	for (int32 Idx = 0; Idx < Jobs.Num() && Idx < Textures.FirstRequests.Num(); Idx++)
+	{
+		const int32 FirstRequest = Textures.FirstRequests[Idx];
+		if (FirstRequest != INDEX_NONE)
+		{
+			FBridgeImportJob& Job = Jobs[Idx];
+			Job.Textures = UPBRMaterialBuilder::ResolveTextureSet(Job.Item.Textures, Textures.Requests, FirstRequest);
+			Job.bTexturesImported = true;
+			for (int32 RequestIdx = FirstRequest; RequestIdx < FirstRequest + Textures.NumRequests[Idx]; RequestIdx++)
 			{
-				const TArray<UMorphTarget*>& MorphTargets = SkeletalMesh->GetMorphTargets();
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Restoring %d morph target names (imported has %d)"), 
-					Item.MorphTargets.Num(), MorphTargets.Num());
-				
-				// Rename morph targets to their original names
-				int32 NumToRename = FMath::Min(Item.MorphTargets.Num(), MorphTargets.Num());
-				for (int32 i = 0; i < NumToRename; i++)
-				{
-					UMorphTarget* MorphTarget = MorphTargets[i];
-					if (MorphTarget)
-					{
-						FString OldName = MorphTarget->GetName();
-						FString NewName = Item.MorphTargets[i];
-						if (OldName != NewName)
-						{
-							MorphTarget->Rename(*NewName, SkeletalMesh, REN_DontCreateRedirectors | REN_NonTransactional);
-							UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Renamed morph target %s -> %s"), *OldName, *NewName);
-						}
-					}
-				}
-				
-				// Mark the mesh as modified so the names are saved
-				SkeletalMesh->MarkPackageDirty();
+				Job.Result.TexturesDeduplicated += Textures.Requests[RequestIdx].bDeduplicated ? 1 : 0;
+				Job.Result.TextureBytesSaved += Textures.Requests[RequestIdx].BytesSaved;
 			}
 		}
+	}
+}
+
+void UBridgeManager::FinalizeImportJob(FBridgeImportJob& Job)
+{
+	BRIDGE_STAGE_SCOPE("Finalize");
+	// Pruned by the job's UBridgeMorphPrunePipeline before the mesh was first built, keyed by the imported object
+	FBridgeMorphPruneResult PruneResult;
+	if (UBridgeMorphPrunePipeline::TakePruneResult(Job.ImportedAsset, PruneResult))
+	{
+		Job.Result.MorphTargetsPruned = PruneResult.NumRemoved;
+		Job.Result.MorphBytesSaved = PruneResult.BytesSaved;
+		UE_LOG(LogAssetsBridge, Log, TEXT("%s"), *PruneResult.ToString(Job.ImportPackageName));
+	}
+
+	// Relocate asset if Interchange created it in a subfolder structure
+	if (Job.ImportedAsset)
+	{
+		bool bRelocateSuccess = false;
+		FString RelocateMessage;
+		UObject* RelocatedAsset = RelocateImportedAsset(Job.ImportedAsset, Job.ImportPackageName, bRelocateSuccess, RelocateMessage);
+		if (bRelocateSuccess && RelocatedAsset)
+		{
+			Job.ImportedAsset = RelocatedAsset;
+			UE_LOG(LogAssetsBridge, Log, TEXT("%s"), *RelocateMessage);
+		}
+		else if (!bRelocateSuccess)
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Relocation issue: %s"), *RelocateMessage);
+			// Continue with original asset even if relocation failed
+		}
+	}
+	
+	// Restore morph target names for skeletal meshes
+	if (Job.Item.StringType == "SkeletalMesh" && Job.Item.MorphTargets.Num() > 0 && Job.ImportedAsset)
+	{
+		USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Job.ImportedAsset);
+		if (SkeletalMesh)
+		{
+			BRIDGE_STAGE_SCOPE("Morph Rename");
+			UE_LOG(LogAssetsBridge, Log, TEXT("Restoring %d morph target names (imported has %d)"), 
+				Job.Item.MorphTargets.Num(), SkeletalMesh->GetMorphTargets().Num());
+			
+			// Rename morph targets to their original names, matched by name rather than position
+			const TMap<FName, FName> Renames = BuildMorphTargetRenames(SkeletalMesh, Job.Item.MorphTargets,
+			                                                           ReadGltfMorphTargetNames(Job.Item.ExportLocation));
+			int32 NumRenamed = 0;
+			bool bRenamed = false;
+			FString RenameMessage;
+			RenameMorphTargets(SkeletalMesh, Renames, NumRenamed, bRenamed, RenameMessage);
+			UE_LOG(LogAssetsBridge, Log, TEXT("%s"), *RenameMessage);
+		}
+	}
+	
+	// Note: Automatic skeleton retargeting has been removed.
+	// Skeletal imports are pointed at their manifest (or matched) skeleton by the Interchange pipeline
+	// configured in ConfigureSkeletalImportPipeline, so no skeleton is generated to begin with.
+	// RetargetMatchedSkeletons only cleans up after an import that generated one anyway.
+	
+	// Process material changeset to restore/handle materials
+	if (Job.ImportedAsset)
+	{
+		UStaticMesh* StaticMesh = Cast<UStaticMesh>(Job.ImportedAsset);
+		USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Job.ImportedAsset);
 		
-		// Note: Automatic skeleton retargeting has been removed.
-		// New skeletal mesh imports will keep their own skeleton and physics assets.
-		// Users should manually retarget if needed through the Unreal Editor skeleton tools.
+		// Get material counts for bounds checking
+		int32 MatCount = StaticMesh ? StaticMesh->GetStaticMaterials().Num() : 
+		                 (SkeletalMesh ? SkeletalMesh->GetMaterials().Num() : 0);
 		
-		// Process material changeset to restore/handle materials
-		if (ImportedAsset)
+		// Log changeset info
+		UE_LOG(LogAssetsBridge, Log, TEXT("Material changeset - Added: %d, Removed: %d, Unchanged: %d"),
+			Job.Item.MaterialChangeset.Added.Num(),
+			Job.Item.MaterialChangeset.Removed.Num(),
+			Job.Item.MaterialChangeset.Unchanged.Num());
+
+		// If the Blender addon baked a PBR texture set, build a Material Instance of the
+		// project master material (M_ORM) and assign it to every slot. This takes precedence
+		// over the per-slot InternalPath restore below. Fully gated behind HasTextures(), so
+		// assets without a baked set follow the original path unchanged.
+		UMaterialInstanceConstant* GeneratedMI = nullptr;
+		if (Job.Item.HasTextures())
 		{
-			UStaticMesh* StaticMesh = Cast<UStaticMesh>(ImportedAsset);
-			USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(ImportedAsset);
-			
-			// Get material counts for bounds checking
-			int32 MatCount = StaticMesh ? StaticMesh->GetStaticMaterials().Num() : 
-			                 (SkeletalMesh ? SkeletalMesh->GetMaterials().Num() : 0);
-			
-			// Log changeset info
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Material changeset - Added: %d, Removed: %d, Unchanged: %d"),
-				Item.MaterialChangeset.Added.Num(),
-				Item.MaterialChangeset.Removed.Num(),
-				Item.MaterialChangeset.Unchanged.Num());
-
-			// If the Blender addon baked a PBR texture set, build a Material Instance of the
-			// project master material (M_ORM) and assign it to every slot. This takes precedence
-			// over the per-slot InternalPath restore below. Fully gated behind HasTextures(), so
-			// assets without a baked set follow the original path unchanged.
-			UMaterialInstanceConstant* GeneratedMI = nullptr;
-			if (Item.HasTextures())
-			{
-				const FString MeshPkgPath = FPackageName::GetLongPackagePath(ImportedAsset->GetOutermost()->GetName());
-				const FString FallbackTexDir = MeshPkgPath / TEXT("Textures");
-				FString BuildMsg;
-				GeneratedMI = UPBRMaterialBuilder::BuildMaterialInstance(
-					Item.Textures, OriginalName, FallbackTexDir, FString(), BuildMsg);
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: PBR material instance: %s"), *BuildMsg);
-
-				if (GeneratedMI)
-				{
-					for (int32 SlotIdx = 0; SlotIdx < MatCount; SlotIdx++)
-					{
-						if (StaticMesh)
-						{
-							StaticMesh->SetMaterial(SlotIdx, GeneratedMI);
-						}
-						else if (SkeletalMesh)
-						{
-							SkeletalMesh->GetMaterials()[SlotIdx].MaterialInterface = GeneratedMI;
-						}
-					}
-					UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Assigned %s to %d slot(s)"), *GeneratedMI->GetName(), MatCount);
-				}
-			}
+			const FString MeshPkgPath = FPackageName::GetLongPackagePath(Job.ImportedAsset->GetOutermost()->GetName());
+			const FString FallbackTexDir = MeshPkgPath / TEXT("Textures");
+			FString BuildMsg;
+			GeneratedMI = Job.bTexturesImported
+				              ? UPBRMaterialBuilder::BuildMaterialInstance(Job.Item.Textures, Job.Textures, Job.OriginalName,
+				                                                           FallbackTexDir, FString(), BuildMsg)
+				              : UPBRMaterialBuilder::BuildMaterialInstance(Job.Item.Textures, Job.OriginalName,
+				                                                           FallbackTexDir, FString(), BuildMsg);
+			UE_LOG(LogAssetsBridge, Log, TEXT("PBR material instance: %s"), *BuildMsg);
 
-			// Restore unchanged materials (materials that existed before and still exist).
-			// Skipped when a baked material instance was generated above.
-			for (const FMaterialSlot& MatSlot : Item.MaterialChangeset.Unchanged)
+			if (GeneratedMI)
 			{
-				if (GeneratedMI)
-				{
-					break;
-				}
-				if (MatSlot.Idx >= MatCount)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Material slot %d out of bounds (mesh has %d slots)"), MatSlot.Idx, MatCount);
-					continue;
-				}
-				
-				FString MaterialPath = MatSlot.InternalPath;
-				if (!MaterialPath.StartsWith(TEXT("/Game")) && !MaterialPath.StartsWith(TEXT("/Engine")))
-				{
-					MaterialPath = TEXT("/Game") + MaterialPath;
-				}
-				
-				UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
-				if (Material)
+				for (int32 SlotIdx = 0; SlotIdx < MatCount; SlotIdx++)
 				{
 					if (StaticMesh)
 					{
-						StaticMesh->SetMaterial(MatSlot.Idx, Material);
+						StaticMesh->SetMaterial(SlotIdx, GeneratedMI);
 					}
 					else if (SkeletalMesh)
 					{
-						SkeletalMesh->GetMaterials()[MatSlot.Idx].MaterialInterface = Material;
+						SkeletalMesh->GetMaterials()[SlotIdx].MaterialInterface = GeneratedMI;
 					}
-					UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Restored unchanged material %s at slot %d"), *MatSlot.Name, MatSlot.Idx);
 				}
+				UE_LOG(LogAssetsBridge, Log, TEXT("Assigned %s to %d slot(s)"), *GeneratedMI->GetName(), MatCount);
 			}
-			
-			// Log added materials (new slots - user needs to assign materials in Unreal)
-			for (const FMaterialSlot& MatSlot : Item.MaterialChangeset.Added)
-			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: New material slot added in Blender: %s at slot %d (assign material in Unreal)"), 
-					*MatSlot.Name, MatSlot.Idx);
-			}
-			
-			// Log removed materials
-			for (const FMaterialSlot& MatSlot : Item.MaterialChangeset.Removed)
-			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Material removed in Blender: %s (was at slot %d)"), 
-					*MatSlot.Name, MatSlot.OriginalIdx);
-			}
-			
-			// Mark as dirty so changes are saved
-			if (StaticMesh)
+		}
+
+		// Restore unchanged materials (materials that existed before and still exist).
+		// Skipped when a baked material instance was generated above.
+		BRIDGE_STAGE_SCOPE("Material Restore");
+		for (const FMaterialSlot& MatSlot : Job.Item.MaterialChangeset.Unchanged)
+		{
+			if (GeneratedMI)
 			{
-				StaticMesh->MarkPackageDirty();
+				break;
 			}
-			else if (SkeletalMesh)
+			if (MatSlot.Idx >= MatCount)
 			{
-				SkeletalMesh->MarkPackageDirty();
+				UE_LOG(LogAssetsBridge, Warning, TEXT("Material slot %d out of bounds (mesh has %d slots)"), MatSlot.Idx, MatCount);
+				continue;
 			}
 			
-			// Update world actors that use this mesh to refresh their materials
-			// This fixes the issue where actors in the viewport lose materials after reimport
-			UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-			if (EditorWorld)
+			// Already in memory when PreloadRestoredMaterials ran, otherwise loaded here
+			const FString MaterialPath = GetRestoredMaterialPath(MatSlot);
+			UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+			if (Material)
 			{
-				int32 UpdatedActorCount = 0;
-				
 				if (StaticMesh)
 				{
-					// Find all actors with StaticMeshComponents using this mesh
-					for (TActorIterator<AActor> ActorIt(EditorWorld); ActorIt; ++ActorIt)
-					{
-						AActor* Actor = *ActorIt;
-						if (!Actor) continue;
-						
-						TArray<UStaticMeshComponent*> MeshComponents;
-						Actor->GetComponents(MeshComponents);
-						
-						for (UStaticMeshComponent* MeshComp : MeshComponents)
-						{
-							if (MeshComp && MeshComp->GetStaticMesh() == StaticMesh)
-							{
-								// Clear all material overrides so the component uses the mesh asset's materials
-								// This is the key fix - after reimport, the component may have stale overrides
-								for (int32 MatIdx = 0; MatIdx < StaticMesh->GetStaticMaterials().Num(); MatIdx++)
-								{
-									// Setting to nullptr clears the override and uses the mesh asset's material
-									MeshComp->SetMaterial(MatIdx, nullptr);
-								}
-								
-								// Force a refresh of the component's rendering
-								MeshComp->MarkRenderStateDirty();
-								UpdatedActorCount++;
-								
-								UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Refreshed materials on world actor '%s' (StaticMeshComponent)"), 
-									*Actor->GetActorLabel());
-							}
-						}
-					}
+					StaticMesh->SetMaterial(MatSlot.Idx, Material);
 				}
 				else if (SkeletalMesh)
 				{
-					// Find all actors with SkeletalMeshComponents using this mesh
-					for (TActorIterator<AActor> ActorIt(EditorWorld); ActorIt; ++ActorIt)
-					{
-						AActor* Actor = *ActorIt;
-						if (!Actor) continue;
-						
-						TArray<USkeletalMeshComponent*> MeshComponents;
-						Actor->GetComponents(MeshComponents);
-						
-						for (USkeletalMeshComponent* MeshComp : MeshComponents)
-						{
-							if (MeshComp && MeshComp->GetSkeletalMeshAsset() == SkeletalMesh)
-							{
-								// Clear all material overrides so the component uses the mesh asset's materials
-								for (int32 MatIdx = 0; MatIdx < SkeletalMesh->GetMaterials().Num(); MatIdx++)
-								{
-									MeshComp->SetMaterial(MatIdx, nullptr);
-								}
-								
-								// Force a refresh of the component's rendering
-								MeshComp->MarkRenderStateDirty();
-								UpdatedActorCount++;
-								
-								UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Refreshed materials on world actor '%s' (SkeletalMeshComponent)"), 
-									*Actor->GetActorLabel());
-							}
-						}
-					}
-				}
-				
-				if (UpdatedActorCount > 0)
-				{
-					UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Updated materials on %d world actor(s) using mesh '%s'"), 
-						UpdatedActorCount, *ImportedAsset->GetName());
+					SkeletalMesh->GetMaterials()[MatSlot.Idx].MaterialInterface = Material;
 				}
+				UE_LOG(LogAssetsBridge, Log, TEXT("Restored unchanged material %s at slot %d"), *MatSlot.Name, MatSlot.Idx);
 			}
 		}
+		
+		// Log added materials (new slots - user needs to assign materials in Unreal)
+		for (const FMaterialSlot& MatSlot : Job.Item.MaterialChangeset.Added)
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("New material slot added in Blender: %s at slot %d (assign material in Unreal)"), 
+				*MatSlot.Name, MatSlot.Idx);
+		}
+		
+		// Log removed materials
+		for (const FMaterialSlot& MatSlot : Job.Item.MaterialChangeset.Removed)
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("Material removed in Blender: %s (was at slot %d)"), 
+				*MatSlot.Name, MatSlot.OriginalIdx);
+		}
+		
+		// Mark as dirty so changes are saved
+		if (StaticMesh)
+		{
+			StaticMesh->MarkPackageDirty();
+		}
+		else if (SkeletalMesh)
+		{
+			SkeletalMesh->MarkPackageDirty();
+		}
+	}
+
+	// Record what this asset was built from so an unchanged source can be skipped next time
+	if (!Job.SourceFingerprint.IsEmpty() && !Job.SourceFingerprint.EndsWith(TEXT("|")))
+	{
+		UEditorAssetLibrary::SetMetadataTag(Job.ImportedAsset, SourceFingerprintTag, Job.SourceFingerprint);
+	}
+
+	Job.Result.Message = FString::Printf(TEXT("Imported %s"), *Job.ImportedAsset->GetPathName());
+}
+
+void UBridgeManager::RefreshWorldMeshUsers(const TArray<FBridgeImportJob>& Jobs)
+{
+	BRIDGE_STAGE_SCOPE("World Refresh");
+	UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!EditorWorld)
+	{
+		return;
+	}
+
+	// Only meshes that were actually reimported can have stale overrides
+	TSet<const UObject*> ImportedMeshes;
+	for (const FBridgeImportJob& Job : Jobs)
+	{
+		if (Job.Result.bIsSuccessful && !Job.Result.bSkipped && Job.ImportedAsset &&
+			(Job.ImportedAsset->IsA<UStaticMesh>() || Job.ImportedAsset->IsA<USkeletalMesh>()))
+		{
+			ImportedMeshes.Add(Job.ImportedAsset);
+		}
+	}
+	if (ImportedMeshes.IsEmpty())
+	{
+		return;
+	}
+
+	// Build the mesh -> components index in a single pass over the level
+	TMap<const UObject*, TArray<UMeshComponent*>> MeshUsers;
+	for (TActorIterator<AActor> ActorIt(EditorWorld); ActorIt; ++ActorIt)
+	{
+		AActor* Actor = *ActorIt;
+		if (!Actor) continue;
+
+		Actor->ForEachComponent<UMeshComponent>(false, [&ImportedMeshes, &MeshUsers](UMeshComponent* MeshComp)
+		{
+			const UObject* Mesh = nullptr;
+			if (const UStaticMeshComponent* StaticComp = Cast<UStaticMeshComponent>(MeshComp))
+			{
+				Mesh = StaticComp->GetStaticMesh();
+			}
+			else if (const USkeletalMeshComponent* SkeletalComp = Cast<USkeletalMeshComponent>(MeshComp))
+			{
+				Mesh = SkeletalComp->GetSkeletalMeshAsset();
+			}
+			if (Mesh && ImportedMeshes.Contains(Mesh))
+			{
+				MeshUsers.FindOrAdd(Mesh).Add(MeshComp);
+			}
+		});
+	}
+
+	for (const TPair<const UObject*, TArray<UMeshComponent*>>& Pair : MeshUsers)
+	{
+		int32 NumSlots = 0;
+		if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Pair.Key))
+		{
+			NumSlots = StaticMesh->GetStaticMaterials().Num();
+		}
+		else if (const USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Pair.Key))
+		{
+			NumSlots = SkeletalMesh->GetMaterials().Num();
+		}
+
+		for (UMeshComponent* MeshComp : Pair.Value)
+		{
+			// Clear all material overrides so the component uses the mesh asset's materials
+			// After reimport the component may still hold overrides for the old slot layout
+			for (int32 MatIdx = 0; MatIdx < NumSlots; MatIdx++)
+			{
+				MeshComp->SetMaterial(MatIdx, nullptr);
+			}
+			MeshComp->MarkRenderStateDirty();
+		}
+
+		UE_LOG(LogAssetsBridge, Log, TEXT("Updated materials on %d world component(s) using mesh '%s'"),
+			Pair.Value.Num(), *Pair.Key->GetName());
+	}
+}
+
+void UBridgeManager::SummarizeImportJobs(const TArray<FBridgeImportJob>& Jobs, bool& bIsSuccessful, FString& OutMessage)
+{
+	int32 NumImported = 0;
+	int32 NumSkipped = 0;
+	int32 NumTexturesDeduplicated = 0;
+	int64 TextureBytesSaved = 0;
+	int32 NumMorphTargetsPruned = 0;
+	int64 MorphBytesSaved = 0;
+	TArray<FString> Failures;
+	for (const FBridgeImportJob& Job : Jobs)
+	{
+		NumTexturesDeduplicated += Job.Result.TexturesDeduplicated;
+		TextureBytesSaved += Job.Result.TextureBytesSaved;
+		NumMorphTargetsPruned += Job.Result.MorphTargetsPruned;
+		MorphBytesSaved += Job.Result.MorphBytesSaved;
+		if (Job.Result.bSkipped)
+		{
+			NumSkipped++;
+		}
+		else if (Job.Result.bIsSuccessful)
+		{
+			NumImported++;
+		}
+		else
+		{
+			Failures.Add(FString::Printf(TEXT("%s: %s"), *Job.Result.SourceFile, *Job.Result.Message));
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Failed to import %s: %s"), *Job.Result.SourceFile, *Job.Result.Message);
+		}
 	}
-	bIsSuccessful = true;
 
-	OutMessage = FString::Printf(TEXT("Operation was successful"));
+	FString TextureSummary = NumTexturesDeduplicated > 0
+		                         ? FString::Printf(TEXT(", deduplicated %d texture(s) saving %.1f MB"),
+		                                           NumTexturesDeduplicated, TextureBytesSaved / (1024.0 * 1024.0))
+		                         : FString();
+	if (NumMorphTargetsPruned > 0 || MorphBytesSaved > 0)
+	{
+		TextureSummary += FString::Printf(TEXT(", pruned %d morph target(s) saving %.1f MB"), NumMorphTargetsPruned, MorphBytesSaved / (1024.0 * 1024.0));
+	}
+	bIsSuccessful = Failures.Num() == 0;
+	if (bIsSuccessful)
+	{
+		OutMessage = FString::Printf(TEXT("Operation was successful, imported %d object(s), skipped %d unchanged%s"),
+		                             NumImported, NumSkipped, *TextureSummary);
+		return;
+	}
+	OutMessage = FString::Printf(TEXT("Imported %d of %d object(s), skipped %d unchanged%s. Failed:\n%s"),
+	                             NumImported, Jobs.Num(), NumSkipped, *TextureSummary, *FString::Join(Failures, TEXT("\n")));
 }
 
 void UBridgeManager::ReplaceRefs(FString OldPackageName, UPackage* NewPackage, bool& bIsSuccessful, FString& OutMessage)
@@ -763,10 +2106,10 @@ bool UBridgeManager::HasExistingPackageAtPath(FString InPath)
 
 UObject* UBridgeManager::ImportAsset(FString InSourcePath, FString InDestPath, FString InMeshType, FString InSkeletonPath, bool& bIsSuccessful, FString& OutMessage)
 {
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: === ImportAsset (glTF) ==="));
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Source: %s"), *InSourcePath);
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Dest: %s"), *InDestPath);
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: MeshType: %s"), *InMeshType);
+	UE_LOG(LogAssetsBridge, Log, TEXT("=== ImportAsset (glTF) ==="));
+	UE_LOG(LogAssetsBridge, Log, TEXT("Source: %s"), *InSourcePath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("Dest: %s"), *InDestPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("MeshType: %s"), *InMeshType);
 	
 	UAssetImportTask* ImportTask = CreateImportTask(InSourcePath, InDestPath, InMeshType, InSkeletonPath, bIsSuccessful, OutMessage);
 	if (!bIsSuccessful)
@@ -800,7 +2143,17 @@ UObject* UBridgeManager::ProcessTask(UAssetImportTask* ImportTask, bool& bIsSucc
 		return nullptr;
 	}
 	AssetTools->Get().ImportAssetTasks({ImportTask});
-	
+	return ResolveImportTask(ImportTask, bIsSuccessful, OutMessage);
+}
+
+UObject* UBridgeManager::ResolveImportTask(UAssetImportTask* ImportTask, bool& bIsSuccessful, FString& OutMessage)
+{
+	if (ImportTask == nullptr)
+	{
+		bIsSuccessful = false;
+		OutMessage = "Could not process task";
+		return nullptr;
+	}
 	const TArray<UObject*>& ImportedObjects = ImportTask->GetObjects();
 	if (ImportedObjects.Num() == 0)
 	{
@@ -810,12 +2163,12 @@ UObject* UBridgeManager::ProcessTask(UAssetImportTask* ImportTask, bool& bIsSucc
 	}
 	
 	// Log all imported objects for debugging
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Import returned %d objects:"), ImportedObjects.Num());
+	UE_LOG(LogAssetsBridge, Log, TEXT("Import returned %d objects:"), ImportedObjects.Num());
 	for (int32 i = 0; i < ImportedObjects.Num(); i++)
 	{
 		if (ImportedObjects[i])
 		{
-			UE_LOG(LogTemp, Log, TEXT("  [%d] %s (%s)"), i, *ImportedObjects[i]->GetPathName(), *ImportedObjects[i]->GetClass()->GetName());
+			UE_LOG(LogAssetsBridge, Log, TEXT("  [%d] %s (%s)"), i, *ImportedObjects[i]->GetPathName(), *ImportedObjects[i]->GetClass()->GetName());
 		}
 	}
 	
@@ -841,33 +2194,80 @@ UObject* UBridgeManager::ProcessTask(UAssetImportTask* ImportTask, bool& bIsSucc
 		{
 			if (Obj)
 			{
-				ImportedObject = Obj;
-				break;
+				ImportedObject = Obj;
+				break;
+			}
+		}
+	}
+	
+	if (ImportedObject == nullptr)
+	{
+		bIsSuccessful = false;
+		OutMessage = "Import completed but no valid object found";
+		return nullptr;
+	}
+	
+	UE_LOG(LogAssetsBridge, Log, TEXT("Selected primary import object: %s"), *ImportedObject->GetPathName());
+	bIsSuccessful = true;
+	OutMessage = "Import success";
+	return ImportedObject;
+}
+
+bool UBridgeManager::ConfigureSkeletalImportPipeline(UAssetImportTask* Task, const FString& InSkeletonPath, const USkeletalMesh* ExistingMesh,
+                                                     bool bAllowPhysicsAssetCreation)
+{
+	USkeleton* Skeleton = LoadObject<USkeleton>(nullptr, *InSkeletonPath);
+	if (!Task || !Skeleton)
+	{
+		UE_LOG(LogAssetsBridge, Warning, TEXT("Could not load skeleton %s - Interchange will generate one"), *InSkeletonPath);
+		return false;
+	}
+
+	// The stack override replaces the project's import stack for this task only, so it starts as a copy of it:
+	// only the generic assets pipeline is duplicated to be pointed at the skeleton, the others stay as they are
+	UInterchangePipelineStackOverride* Stack = NewObject<UInterchangePipelineStackOverride>();
+	UInterchangeGenericAssetsPipeline* Pipeline = nullptr;
+	for (const FSoftObjectPath& PipelinePath : UAssetsBridgeTools::GetProjectImportPipelines(Task->Filename))
+	{
+		// Pipelines are assets or Blueprints, the latter only tell their type through the generated class
+		const UObject* ProjectPipeline = Pipeline ? nullptr : PipelinePath.TryLoad();
+		const UBlueprint* Blueprint = Cast<UBlueprint>(ProjectPipeline);
+		const UClass* PipelineClass = Blueprint ? Blueprint->GeneratedClass.Get() : (ProjectPipeline ? ProjectPipeline->GetClass() : nullptr);
+		if (PipelineClass && PipelineClass->IsChildOf<UInterchangeGenericAssetsPipeline>())
+		{
+			Pipeline = Cast<UInterchangeGenericAssetsPipeline>(UE::Interchange::GeneratePipelineInstance(PipelinePath));
+			if (Pipeline)
+			{
+				Stack->AddPipeline(Pipeline);
+				continue;
 			}
 		}
+		Stack->OverridePipelines.Add(PipelinePath);
 	}
-	
-	if (ImportedObject == nullptr)
+	if (!Pipeline)
 	{
-		bIsSuccessful = false;
-		OutMessage = "Import completed but no valid object found";
-		return nullptr;
+		UE_LOG(LogAssetsBridge, Warning, TEXT("The project import stack for %s has no generic assets pipeline, adding a default one"), *Task->Filename);
+		Pipeline = NewObject<UInterchangeGenericAssetsPipeline>();
+		Stack->AddPipeline(Pipeline);
 	}
-	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Selected primary import object: %s"), *ImportedObject->GetPathName());
-	bIsSuccessful = true;
-	OutMessage = "Import success";
-	return ImportedObject;
+	Pipeline->CommonSkeletalMeshesAndAnimationsProperties->Skeleton = Skeleton;
+	UPhysicsAsset* ExistingPhysicsAsset = ExistingMesh ? ExistingMesh->GetPhysicsAsset() : nullptr;
+	Pipeline->MeshPipeline->bCreatePhysicsAsset = bAllowPhysicsAssetCreation && !ExistingPhysicsAsset;
+	Pipeline->MeshPipeline->PhysicsAsset = ExistingPhysicsAsset;
+	Task->Options = Stack;
+	UE_LOG(LogAssetsBridge, Log, TEXT("Import pipeline uses skeleton %s, physics asset %s"), *Skeleton->GetPathName(),
+		ExistingPhysicsAsset ? *ExistingPhysicsAsset->GetPathName() : (Pipeline->MeshPipeline->bCreatePhysicsAsset ? TEXT("generated") : TEXT("none")));
+	return true;
 }
 
 UAssetImportTask* UBridgeManager::CreateImportTask(FString InSourcePath, FString InDestPath, FString InMeshType,
                                                    FString InSkeletonPath, bool& bIsSuccessful, FString& OutMessage)
 {
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: === CreateImportTask (glTF) ==="));
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Source: %s"), *InSourcePath);
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Dest: %s"), *InDestPath);
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: MeshType: %s"), *InMeshType);
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: SkeletonPath: %s"), *InSkeletonPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("=== CreateImportTask (glTF) ==="));
+	UE_LOG(LogAssetsBridge, Log, TEXT("Source: %s"), *InSourcePath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("Dest: %s"), *InDestPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("MeshType: %s"), *InMeshType);
+	UE_LOG(LogAssetsBridge, Log, TEXT("SkeletonPath: %s"), *InSkeletonPath);
 	
 	UAssetImportTask* ResTask = NewObject<UAssetImportTask>();
 	if (ResTask == nullptr)
@@ -894,38 +2294,49 @@ UAssetImportTask* UBridgeManager::CreateImportTask(FString InSourcePath, FString
 	
 	if (bIsSkeletalMesh)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: SkeletonPath from JSON: %s"), *InSkeletonPath);
+		UE_LOG(LogAssetsBridge, Log, TEXT("SkeletonPath from JSON: %s"), *InSkeletonPath);
 		
 		// Check if destination mesh exists
 		FString FullAssetPath = InDestPath + TEXT(".") + FPaths::GetBaseFilename(InDestPath);
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Looking for existing mesh at: %s"), *FullAssetPath);
+		UE_LOG(LogAssetsBridge, Log, TEXT("Looking for existing mesh at: %s"), *FullAssetPath);
 		USkeletalMesh* ExistingMesh = LoadObject<USkeletalMesh>(nullptr, *FullAssetPath);
 		if (ExistingMesh)
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Found existing mesh: %s"), *ExistingMesh->GetPathName());
+			UE_LOG(LogAssetsBridge, Log, TEXT("Found existing mesh: %s"), *ExistingMesh->GetPathName());
 			if (ExistingMesh->GetSkeleton())
 			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Existing mesh skeleton: %s"), *ExistingMesh->GetSkeleton()->GetPathName());
+				UE_LOG(LogAssetsBridge, Log, TEXT("Existing mesh skeleton: %s"), *ExistingMesh->GetSkeleton()->GetPathName());
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: No existing mesh found - new import"));
+			UE_LOG(LogAssetsBridge, Log, TEXT("No existing mesh found - new import"));
+		}
+		
+		// A reimport without a skeleton path keeps the skeleton the mesh already uses
+		FString SkeletonPath = InSkeletonPath;
+		if (SkeletonPath.IsEmpty() && ExistingMesh && ExistingMesh->GetSkeleton())
+		{
+			SkeletonPath = ExistingMesh->GetSkeleton()->GetPathName();
+		}
+		if (!SkeletonPath.IsEmpty())
+		{
+			ConfigureSkeletalImportPipeline(ResTask, SkeletonPath, ExistingMesh, true);
 		}
 		
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Skeletal mesh import via glTF/Interchange"));
+		UE_LOG(LogAssetsBridge, Log, TEXT("Skeletal mesh import via glTF/Interchange"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Static mesh import via glTF/Interchange"));
+		UE_LOG(LogAssetsBridge, Log, TEXT("Static mesh import via glTF/Interchange"));
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Import task configured:"));
-	UE_LOG(LogTemp, Log, TEXT("  - Source: %s"), *ResTask->Filename);
-	UE_LOG(LogTemp, Log, TEXT("  - DestPath: %s"), *ResTask->DestinationPath);
-	UE_LOG(LogTemp, Log, TEXT("  - DestName: %s"), *ResTask->DestinationName);
-	UE_LOG(LogTemp, Log, TEXT("  - bReplaceExisting: %s"), ResTask->bReplaceExisting ? TEXT("true") : TEXT("false"));
-	UE_LOG(LogTemp, Log, TEXT("  - bAutomated: %s"), ResTask->bAutomated ? TEXT("true") : TEXT("false"));
+	UE_LOG(LogAssetsBridge, Log, TEXT("Import task configured:"));
+	UE_LOG(LogAssetsBridge, Log, TEXT("  - Source: %s"), *ResTask->Filename);
+	UE_LOG(LogAssetsBridge, Log, TEXT("  - DestPath: %s"), *ResTask->DestinationPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("  - DestName: %s"), *ResTask->DestinationName);
+	UE_LOG(LogAssetsBridge, Log, TEXT("  - bReplaceExisting: %s"), ResTask->bReplaceExisting ? TEXT("true") : TEXT("false"));
+	UE_LOG(LogAssetsBridge, Log, TEXT("  - bAutomated: %s"), ResTask->bAutomated ? TEXT("true") : TEXT("false"));
 
 	bIsSuccessful = true;
 	OutMessage = "Task Created";
@@ -964,11 +2375,11 @@ void UBridgeManager::FindGeneratedAssetsNearMesh(USkeletalMesh* InMesh, USkeleto
 	// Log what we found
 	if (OutGeneratedSkeleton)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Found skeleton on mesh: %s"), *OutGeneratedSkeleton->GetPathName());
+		UE_LOG(LogAssetsBridge, Log, TEXT("Found skeleton on mesh: %s"), *OutGeneratedSkeleton->GetPathName());
 	}
 	if (OutGeneratedPhysicsAsset)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Found physics asset on mesh: %s"), *OutGeneratedPhysicsAsset->GetPathName());
+		UE_LOG(LogAssetsBridge, Log, TEXT("Found physics asset on mesh: %s"), *OutGeneratedPhysicsAsset->GetPathName());
 	}
 }
 
@@ -980,13 +2391,13 @@ FSkeletonImportResult UBridgeManager::AnalyzeSkeletalMeshImport(USkeletalMesh* I
 	
 	if (!InImportedMesh)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: AnalyzeSkeletalMeshImport called with null mesh"));
+		UE_LOG(LogAssetsBridge, Warning, TEXT("AnalyzeSkeletalMeshImport called with null mesh"));
 		return Result;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: === Analyzing Skeletal Mesh Import ==="));
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Mesh: %s"), *InImportedMesh->GetPathName());
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Intended skeleton: %s"), *InIntendedSkeletonPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("=== Analyzing Skeletal Mesh Import ==="));
+	UE_LOG(LogAssetsBridge, Log, TEXT("Mesh: %s"), *InImportedMesh->GetPathName());
+	UE_LOG(LogAssetsBridge, Log, TEXT("Intended skeleton: %s"), *InIntendedSkeletonPath);
 	
 	// Find what was generated with the import
 	USkeleton* GeneratedSkeleton = nullptr;
@@ -1000,11 +2411,11 @@ FSkeletonImportResult UBridgeManager::AnalyzeSkeletalMeshImport(USkeletalMesh* I
 		IntendedSkeleton = LoadObject<USkeleton>(nullptr, *InIntendedSkeletonPath);
 		if (IntendedSkeleton)
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Found intended skeleton: %s"), *IntendedSkeleton->GetPathName());
+			UE_LOG(LogAssetsBridge, Log, TEXT("Found intended skeleton: %s"), *IntendedSkeleton->GetPathName());
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Could not load intended skeleton at: %s"), *InIntendedSkeletonPath);
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Could not load intended skeleton at: %s"), *InIntendedSkeletonPath);
 		}
 	}
 	
@@ -1019,18 +2430,18 @@ FSkeletonImportResult UBridgeManager::AnalyzeSkeletalMeshImport(USkeletalMesh* I
 			if (GeneratedSkeleton != IntendedSkeleton)
 			{
 				Result.bNewSkeletonGenerated = true;
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: New skeleton was auto-generated (different from intended)"));
+				UE_LOG(LogAssetsBridge, Log, TEXT("New skeleton was auto-generated (different from intended)"));
 			}
 			else
 			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Mesh is using the intended skeleton - no retargeting needed"));
+				UE_LOG(LogAssetsBridge, Log, TEXT("Mesh is using the intended skeleton - no retargeting needed"));
 			}
 		}
 		else if (!InIntendedSkeletonPath.IsEmpty())
 		{
 			// Intended skeleton was specified but couldn't be loaded - assume new was generated
 			Result.bNewSkeletonGenerated = true;
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: New skeleton generated (intended skeleton not found)"));
+			UE_LOG(LogAssetsBridge, Log, TEXT("New skeleton generated (intended skeleton not found)"));
 		}
 	}
 	
@@ -1047,11 +2458,11 @@ FSkeletonImportResult UBridgeManager::AnalyzeSkeletalMeshImport(USkeletalMesh* I
 		if (PhysicsPath.Contains(MeshPath) || MeshPath.Contains(PhysicsPath))
 		{
 			Result.bNewPhysicsAssetGenerated = true;
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Physics asset appears to be auto-generated"));
+			UE_LOG(LogAssetsBridge, Log, TEXT("Physics asset appears to be auto-generated"));
 		}
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Analysis complete - NewSkeleton: %s, NewPhysicsAsset: %s"),
+	UE_LOG(LogAssetsBridge, Log, TEXT("Analysis complete - NewSkeleton: %s, NewPhysicsAsset: %s"),
 		Result.bNewSkeletonGenerated ? TEXT("Yes") : TEXT("No"),
 		Result.bNewPhysicsAssetGenerated ? TEXT("Yes") : TEXT("No"));
 	
@@ -1064,6 +2475,13 @@ bool UBridgeManager::PromptUserForSkeletonRetarget(const FSkeletonImportResult&
 	{
 		return false;
 	}
+
+	// Nobody can answer the dialog, so keep the generated skeleton like a declined prompt would
+	if (UAssetsBridgeTools::IsUnattended())
+	{
+		UE_LOG(LogAssetsBridge, Display, TEXT("Unattended: keeping generated skeleton %s"), *InImportResult.GeneratedSkeletonPath);
+		return false;
+	}
 	
 	// Build the message
 	FString Message = FString::Printf(
@@ -1087,199 +2505,553 @@ bool UBridgeManager::PromptUserForSkeletonRetarget(const FSkeletonImportResult&
 	return UserChoice == EAppReturnType::Yes;
 }
 
-void UBridgeManager::RetargetSkeletalMeshToSkeleton(const FSkeletonImportResult& InImportResult, bool bDeleteGeneratedAssets, bool& bIsSuccessful, FString& OutMessage)
+bool UBridgeManager::IsHierarchyCompatible(const FReferenceSkeleton& MeshRefSkeleton, const FReferenceSkeleton& TargetRefSkeleton,
+                                           bool& bOutBonesFound)
 {
-	bIsSuccessful = false;
-	
-	if (!InImportResult.ImportedMesh)
+	// Parents always precede their children in a reference skeleton, so a bone's parent is already mapped
+	// when the bone is checked
+	TArray<int32> BoneMap;
+	BoneMap.SetNumUninitialized(MeshRefSkeleton.GetNum());
+	bOutBonesFound = true;
+	bool bHierarchyCompatible = true;
+	for (int32 BoneIdx = 0; BoneIdx < MeshRefSkeleton.GetNum(); ++BoneIdx)
 	{
-		OutMessage = TEXT("No imported mesh to retarget");
-		return;
+		const FName BoneName = MeshRefSkeleton.GetBoneName(BoneIdx);
+		BoneMap[BoneIdx] = TargetRefSkeleton.FindBoneIndex(BoneName);
+		if (BoneMap[BoneIdx] == INDEX_NONE)
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Bone '%s' not found in target skeleton"), *BoneName.ToString());
+			bOutBonesFound = false;
+			continue;
+		}
+		const int32 MeshParentIdx = MeshRefSkeleton.GetParentIndex(BoneIdx);
+		if (MeshParentIdx != INDEX_NONE && TargetRefSkeleton.GetParentIndex(BoneMap[BoneIdx]) != BoneMap[MeshParentIdx])
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("Bone '%s' has a different parent in target skeleton"), *BoneName.ToString());
+			bHierarchyCompatible = false;
+		}
 	}
-	
-	if (InImportResult.IntendedSkeletonPath.IsEmpty())
+	return bHierarchyCompatible && bOutBonesFound;
+}
+
+/**
+ * Adds the skeleton and physics asset a retargeted mesh no longer uses to OutToDelete, but only when the
+ * analysis reported them as generated by this import and their paths still match what it recorded.
+ */
+static void CollectGeneratedAssets(const FSkeletonImportResult& InImportResult, USkeleton* OldSkeleton, UPhysicsAsset* OldPhysicsAsset,
+                                   const USkeleton* IntendedSkeleton, TArray<UObject*>& OutToDelete)
+{
+	// Delete the old skeleton ONLY if it was auto-generated during this import and different from intended
+	if (OldSkeleton && OldSkeleton != IntendedSkeleton && InImportResult.bNewSkeletonGenerated)
 	{
-		OutMessage = TEXT("No intended skeleton path specified");
-		return;
+		// Additional safety check: only delete if the path matches the generated path
+		if (OldSkeleton->GetPathName() == InImportResult.GeneratedSkeletonPath)
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("Deleting auto-generated skeleton: %s"), *OldSkeleton->GetPathName());
+			OutToDelete.AddUnique(OldSkeleton);
+		}
+		else
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("Preserving skeleton (path mismatch - may be pre-existing): %s"), *OldSkeleton->GetPathName());
+		}
+	}
+	else if (OldSkeleton && OldSkeleton != IntendedSkeleton)
+	{
+		UE_LOG(LogAssetsBridge, Log, TEXT("Preserving pre-existing skeleton: %s"), *OldSkeleton->GetPathName());
 	}
 	
-	// Load the intended skeleton
-	USkeleton* IntendedSkeleton = LoadObject<USkeleton>(nullptr, *InImportResult.IntendedSkeletonPath);
-	if (!IntendedSkeleton)
+	// Delete the old physics asset ONLY if it was auto-generated during this import
+	// Pre-existing physics assets should be preserved
+	if (OldPhysicsAsset && InImportResult.bNewPhysicsAssetGenerated)
+	{
+		// Additional safety check: only delete if the path matches the generated path
+		if (OldPhysicsAsset->GetPathName() == InImportResult.GeneratedPhysicsAssetPath)
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("Deleting auto-generated physics asset: %s"), *OldPhysicsAsset->GetPathName());
+			OutToDelete.AddUnique(OldPhysicsAsset);
+		}
+		else
+		{
+			UE_LOG(LogAssetsBridge, Log, TEXT("Preserving physics asset (path mismatch - may be pre-existing): %s"), *OldPhysicsAsset->GetPathName());
+		}
+	}
+	else if (OldPhysicsAsset)
+	{
+		UE_LOG(LogAssetsBridge, Log, TEXT("Preserving pre-existing physics asset: %s"), *OldPhysicsAsset->GetPathName());
+	}
+}
+
+void UBridgeManager::RetargetSkeletalMeshToSkeleton(const FSkeletonImportResult& InImportResult, bool bDeleteGeneratedAssets, bool& bIsSuccessful, FString& OutMessage)
+{
+	RetargetSkeletalMeshesToSkeleton({InImportResult}, bDeleteGeneratedAssets, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
 	{
-		OutMessage = FString::Printf(TEXT("Could not load intended skeleton: %s"), *InImportResult.IntendedSkeletonPath);
 		return;
 	}
+	OutMessage = FString::Printf(TEXT("Successfully retargeted mesh to skeleton: %s"),
+	                             *FPackageName::ObjectPathToObjectName(InImportResult.IntendedSkeletonPath));
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: === Retargeting Skeletal Mesh ==="));
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Mesh: %s"), *InImportResult.ImportedMesh->GetPathName());
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Target Skeleton: %s"), *IntendedSkeleton->GetPathName());
-	
-	USkeletalMesh* Mesh = InImportResult.ImportedMesh;
-	
-	// Store references to generated assets before reassignment
-	USkeleton* OldSkeleton = Mesh->GetSkeleton();
-	UPhysicsAsset* OldPhysicsAsset = Mesh->GetPhysicsAsset();
-	
-	// Check skeleton compatibility by comparing bone structure
-	const FReferenceSkeleton& MeshRefSkeleton = Mesh->GetRefSkeleton();
-	const FReferenceSkeleton& TargetRefSkeleton = IntendedSkeleton->GetReferenceSkeleton();
+	// Show notification to user
+	UAssetsBridgeTools::ShowNotification(OutMessage);
+}
+
+void UBridgeManager::RetargetSkeletalMeshesToSkeleton(const TArray<FSkeletonImportResult>& InImportResults, bool bDeleteGeneratedAssets,
+                                                      bool& bIsSuccessful, FString& OutMessage)
+{
+	BRIDGE_STAGE_SCOPE("Skeleton Retarget");
+	bIsSuccessful = false;
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Mesh has %d bones, Target skeleton has %d bones"),
-		MeshRefSkeleton.GetNum(), TargetRefSkeleton.GetNum());
+	// Meshes are handled per target skeleton so each skeleton is loaded and dirtied once
+	TMap<FString, TArray<const FSkeletonImportResult*>> ResultsBySkeleton;
+	int32 NumFailed = 0;
+	for (const FSkeletonImportResult& Result : InImportResults)
+	{
+		if (!Result.ImportedMesh)
+		{
+			OutMessage = TEXT("No imported mesh to retarget");
+			NumFailed++;
+		}
+		else if (Result.IntendedSkeletonPath.IsEmpty())
+		{
+			OutMessage = TEXT("No intended skeleton path specified");
+			NumFailed++;
+		}
+		else
+		{
+			ResultsBySkeleton.FindOrAdd(Result.IntendedSkeletonPath).Add(&Result);
+		}
+	}
 	
-	// Verify bone compatibility - check that all mesh bones exist in target skeleton
-	bool bBonesCompatible = true;
-	for (int32 BoneIdx = 0; BoneIdx < MeshRefSkeleton.GetNum(); ++BoneIdx)
+	const bool bFastRetarget = GetDefault<UABSettings>()->bFastSkeletonRetarget;
+	TArray<USkeletalMesh*> Rebuilds;
+	TArray<UObject*> ToDelete;
+	int32 NumRetargeted = 0;
+	for (const TPair<FString, TArray<const FSkeletonImportResult*>>& Group : ResultsBySkeleton)
 	{
-		FName BoneName = MeshRefSkeleton.GetBoneName(BoneIdx);
-		int32 TargetBoneIdx = TargetRefSkeleton.FindBoneIndex(BoneName);
+		// Load the intended skeleton
+		USkeleton* IntendedSkeleton = LoadObject<USkeleton>(nullptr, *Group.Key);
+		if (!IntendedSkeleton)
+		{
+			OutMessage = FString::Printf(TEXT("Could not load intended skeleton: %s"), *Group.Key);
+			NumFailed += Group.Value.Num();
+			continue;
+		}
+		UE_LOG(LogAssetsBridge, Log, TEXT("=== Retargeting %d Skeletal Mesh(es) ==="), Group.Value.Num());
+		UE_LOG(LogAssetsBridge, Log, TEXT("Target Skeleton: %s"), *IntendedSkeleton->GetPathName());
 		
-		if (TargetBoneIdx == INDEX_NONE)
+		bool bSkeletonChanged = false;
+		for (const FSkeletonImportResult* Result : Group.Value)
+		{
+			USkeletalMesh* Mesh = Result->ImportedMesh;
+			UE_LOG(LogAssetsBridge, Log, TEXT("Mesh: %s (%d bones, target has %d)"), *Mesh->GetPathName(),
+				Mesh->GetRefSkeleton().GetNum(), IntendedSkeleton->GetReferenceSkeleton().GetNum());
+			
+			// Store references to generated assets before reassignment
+			USkeleton* OldSkeleton = Mesh->GetSkeleton();
+			UPhysicsAsset* OldPhysicsAsset = Mesh->GetPhysicsAsset();
+			
+			bool bBonesFound = true;
+			const bool bHierarchyCompatible = IsHierarchyCompatible(Mesh->GetRefSkeleton(), IntendedSkeleton->GetReferenceSkeleton(), bBonesFound);
+			
+			// Skin weights, section bone maps and required bones all index the mesh's own reference
+			// skeleton, and the mesh-to-skeleton linkup is built on demand from bone names. A target that
+			// already contains the hierarchy therefore needs no merge and no LOD rebuild.
+			if (!bHierarchyCompatible || !bFastRetarget)
+			{
+				if (!bBonesFound)
+				{
+					UE_LOG(LogAssetsBridge, Log, TEXT("Some bones are missing in target skeleton - will merge them"));
+				}
+				// The mesh's bones are merged into the target before it is assigned; the skeleton is
+				// marked dirty once for the whole group and the mesh is rebuilt below
+				IntendedSkeleton->MergeAllBonesToBoneTree(Mesh);
+				bSkeletonChanged = true;
+				Rebuilds.Add(Mesh);
+			}
+			
+			Mesh->SetSkeleton(IntendedSkeleton);
+			
+			// Clear the physics asset (user may want to assign a shared one or regenerate)
+			Mesh->SetPhysicsAsset(nullptr);
+			
+			// Mark the mesh as dirty
+			Mesh->MarkPackageDirty();
+			
+			if (bDeleteGeneratedAssets)
+			{
+				CollectGeneratedAssets(*Result, OldSkeleton, OldPhysicsAsset, IntendedSkeleton, ToDelete);
+			}
+			NumRetargeted++;
+		}
+		if (bSkeletonChanged)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Bone '%s' not found in target skeleton"), *BoneName.ToString());
-			bBonesCompatible = false;
+			IntendedSkeleton->MarkPackageDirty();
 		}
 	}
 	
-	if (!bBonesCompatible)
+	// PostEditChange only starts each rebuild; the skinned asset compiler runs them in parallel and the
+	// wait keeps the generated assets referenced until every mesh is rebuilt against its new skeleton
+	if (Rebuilds.Num() > 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Some bones are missing in target skeleton - will merge them"));
+		BRIDGE_STAGE_SCOPE("Skeletal Mesh Rebuild");
+		UE_LOG(LogAssetsBridge, Log, TEXT("Rebuilding %d mesh(es) against merged skeletons..."), Rebuilds.Num());
+		TArray<USkinnedAsset*> SkinnedAssets;
+		for (USkeletalMesh* Mesh : Rebuilds)
+		{
+			Mesh->PostEditChange();
+			SkinnedAssets.Add(Mesh);
+		}
+		FSkinnedAssetCompilingManager::Get().FinishCompilation(SkinnedAssets);
 	}
 	
-	// IMPORTANT: Order of operations for skeleton reassignment:
-	// 1. First merge the mesh's bones into the target skeleton
-	// 2. Mark skeleton dirty so merged bones persist
-	// 3. Then set the skeleton on the mesh
-	// 4. Rebuild mesh LOD info to use new skeleton
-	
-	// Step 1: Merge bones from mesh into target skeleton FIRST
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Merging mesh bones into target skeleton..."));
-	IntendedSkeleton->MergeAllBonesToBoneTree(Mesh);
-	IntendedSkeleton->MarkPackageDirty();
-	
-	// Step 2: Set the skeleton on the mesh
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Setting skeleton on mesh..."));
-	Mesh->SetSkeleton(IntendedSkeleton);
-	
-	// Step 3: Rebuild the mesh's ref skeleton to match the new skeleton
-	// This is critical - we need to rebuild the LOD info with correct bone indices
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Rebuilding mesh reference skeleton..."));
-	
-	// Get the mesh's ref skeleton and rebuild it from the target skeleton
-	FReferenceSkeleton& MeshRefSkel = const_cast<FReferenceSkeleton&>(Mesh->GetRefSkeleton());
-	
-	// Create bone map from mesh bones to skeleton bones
-	TArray<int32> BoneMap;
-	BoneMap.SetNum(MeshRefSkel.GetNum());
-	
-	const FReferenceSkeleton& SkeletonRefSkel = IntendedSkeleton->GetReferenceSkeleton();
-	for (int32 BoneIdx = 0; BoneIdx < MeshRefSkel.GetNum(); ++BoneIdx)
+	// Delete auto-generated assets with one delete so references are gathered once
+	if (ToDelete.Num() > 0)
 	{
-		FName BoneName = MeshRefSkel.GetBoneName(BoneIdx);
-		int32 SkeletonBoneIdx = SkeletonRefSkel.FindBoneIndex(BoneName);
-		BoneMap[BoneIdx] = SkeletonBoneIdx;
-		
-		if (SkeletonBoneIdx != INDEX_NONE)
+		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+		for (UObject* Asset : ToDelete)
+		{
+			// Close any editors using this asset
+			AssetEditorSubsystem->CloseAllEditorsForAsset(Asset);
+		}
+		if (UEditorAssetLibrary::DeleteLoadedAssets(ToDelete))
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("AssetsBridge: Bone '%s' mapped: mesh[%d] -> skeleton[%d]"), 
-				*BoneName.ToString(), BoneIdx, SkeletonBoneIdx);
+			UE_LOG(LogAssetsBridge, Log, TEXT("Deleted %d auto-generated asset(s)"), ToDelete.Num());
+		}
+		else
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("Failed to delete some of %d auto-generated asset(s)"), ToDelete.Num());
 		}
 	}
 	
-	// Clear the physics asset (user may want to assign a shared one or regenerate)
-	Mesh->SetPhysicsAsset(nullptr);
-	
-	// Mark the mesh as dirty
-	Mesh->MarkPackageDirty();
-	
-	// Force a PostEditChange to rebuild all internal mesh data
-	Mesh->PostEditChange();
-	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Skeleton reassigned successfully"));
-	
-	// Delete auto-generated assets if requested
-	if (bDeleteGeneratedAssets)
+	bIsSuccessful = NumRetargeted > 0 && NumFailed == 0;
+	if (NumFailed == 0)
+	{
+		OutMessage = FString::Printf(TEXT("Retargeted %d mesh(es) to %d skeleton(s), %d rebuilt"), NumRetargeted, ResultsBySkeleton.Num(), Rebuilds.Num());
+	}
+	else if (InImportResults.Num() > 1)
+	{
+		OutMessage = FString::Printf(TEXT("Retargeted %d mesh(es), %d failed: %s"), NumRetargeted, NumFailed, *OutMessage);
+	}
+}
+
+TMap<FName, FName> UBridgeManager::BuildMorphTargetRenames(const USkeletalMesh* InMesh, const TArray<FString>& InManifestNames,
+                                                           const TArray<FString>& InGltfTargetNames)
+{
+	TMap<FName, FName> Renames;
+	if (!InMesh)
+	{
+		return Renames;
+	}
+
+	// FName keys compare case-insensitively like the morph target object names themselves, so two names that
+	// only differ in case (or sanitize to the same name) cannot both exist on the mesh; the first one wins
+	auto AddKey = [InMesh](TMap<FName, FName>& Map, const FName Key, const FName Name, const TCHAR* Source)
 	{
-		// Delete the old skeleton ONLY if it was auto-generated during this import and different from intended
-		if (OldSkeleton && OldSkeleton != IntendedSkeleton && InImportResult.bNewSkeletonGenerated)
+		const FName* Existing = Map.Find(Key);
+		if (!Existing)
 		{
-			FString OldSkeletonPath = OldSkeleton->GetPathName();
-			
-			// Additional safety check: only delete if the path matches the generated path
-			if (OldSkeletonPath == InImportResult.GeneratedSkeletonPath)
+			Map.Add(Key, Name);
+		}
+		else if (!Existing->IsEqual(Name, ENameCase::CaseSensitive))
+		{
+			UE_LOG(LogAssetsBridge, Warning, TEXT("%s: %s morph targets '%s' and '%s' collide as '%s' (names are case-insensitive), '%s' is not restored"),
+			       *InMesh->GetName(), Source, *Existing->ToString(), *Name.ToString(), *Key.ToString(), *Name.ToString());
+		}
+	};
+
+	// Every form a manifest name can take on import (as is, or sanitized into an object name) -> manifest name
+	TMap<FName, FName> ManifestByKey;
+	for (const FString& Name : InManifestNames)
+	{
+		const FName ManifestName(*Name);
+		AddKey(ManifestByKey, ManifestName, ManifestName, TEXT("manifest"));
+		const FName SanitizedName(*ObjectTools::SanitizeObjectName(Name));
+		if (!SanitizedName.IsEqual(ManifestName, ENameCase::CaseSensitive))
+		{
+			AddKey(ManifestByKey, SanitizedName, ManifestName, TEXT("manifest"));
+		}
+	}
+
+	// The importer names morph targets after the glTF target names, possibly sanitized -> glTF target name
+	TMap<FName, FName> GltfByKey;
+	for (const FString& Name : InGltfTargetNames)
+	{
+		const FName GltfName(*Name);
+		AddKey(GltfByKey, GltfName, GltfName, TEXT("glTF"));
+		const FName SanitizedName(*ObjectTools::SanitizeObjectName(Name));
+		if (!SanitizedName.IsEqual(GltfName, ENameCase::CaseSensitive))
+		{
+			AddKey(GltfByKey, SanitizedName, GltfName, TEXT("glTF"));
+		}
+	}
+
+	const TArray<TObjectPtr<UMorphTarget>>& MorphTargets = InMesh->GetMorphTargets();
+	for (int32 MorphIdx = 0; MorphIdx < MorphTargets.Num(); MorphIdx++)
+	{
+		if (!MorphTargets[MorphIdx])
+		{
+			continue;
+		}
+		const FName ImportedName = MorphTargets[MorphIdx]->GetFName();
+		const FName* ManifestName = ManifestByKey.Find(ImportedName);
+		// Otherwise through the glTF target name the imported name was made from, never by position
+		if (!ManifestName)
+		{
+			if (const FName* GltfName = GltfByKey.Find(ImportedName))
 			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Deleting auto-generated skeleton: %s"), *OldSkeletonPath);
-				
-				// Close any editors using this asset
-				GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(OldSkeleton);
-				
-				// Delete the asset
-				bool bDeleted = UEditorAssetLibrary::DeleteAsset(OldSkeletonPath);
-				if (bDeleted)
-				{
-					UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Successfully deleted auto-generated skeleton"));
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Failed to delete auto-generated skeleton"));
-				}
+				ManifestName = ManifestByKey.Find(*GltfName);
 			}
-			else
+		}
+		// Files without recorded shape key names can only be matched by manifest order
+		if (!ManifestName && InGltfTargetNames.Num() == 0 && InManifestNames.IsValidIndex(MorphIdx))
+		{
+			ManifestName = ManifestByKey.Find(FName(*InManifestNames[MorphIdx]));
+		}
+		if (ManifestName)
+		{
+			Renames.Add(ImportedName, *ManifestName);
+		}
+	}
+	return Renames;
+}
+
+void UBridgeManager::RenameMorphTargets(USkeletalMesh* InMesh, const TMap<FName, FName>& InNewNames, int32& OutNumRenamed,
+                                        bool& bIsSuccessful, FString& OutMessage)
+{
+	OutNumRenamed = 0;
+	if (!InMesh)
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("No mesh to rename morph targets on");
+		return;
+	}
+
+	// Only morphs whose name actually changes (including case) are renamed, each target name once
+	TArray<TPair<UMorphTarget*, FName>> Pending;
+	TSet<FName> TargetNames;
+	TSet<UMorphTarget*> Moving;
+	for (UMorphTarget* MorphTarget : InMesh->GetMorphTargets())
+	{
+		const FName* NewName = MorphTarget ? InNewNames.Find(MorphTarget->GetFName()) : nullptr;
+		if (NewName && !NewName->IsNone() && !MorphTarget->GetFName().IsEqual(*NewName, ENameCase::CaseSensitive) && !TargetNames.Contains(*NewName))
+		{
+			Pending.Emplace(MorphTarget, *NewName);
+			TargetNames.Add(*NewName);
+			Moving.Add(MorphTarget);
+		}
+	}
+
+	// A morph that keeps its name blocks any rename onto that name
+	int32 NumBlocked = 0;
+	for (UMorphTarget* MorphTarget : InMesh->GetMorphTargets())
+	{
+		if (MorphTarget && !Moving.Contains(MorphTarget) && TargetNames.Contains(MorphTarget->GetFName()))
+		{
+			NumBlocked += Pending.RemoveAll([MorphTarget](const TPair<UMorphTarget*, FName>& Rename)
 			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Preserving skeleton (path mismatch - may be pre-existing): %s"), *OldSkeletonPath);
-			}
+				return Rename.Value == MorphTarget->GetFName();
+			});
 		}
-		else if (OldSkeleton && OldSkeleton != IntendedSkeleton)
+	}
+
+	TArray<TPair<FName, FName>> SourceRenames;
+	for (const TPair<UMorphTarget*, FName>& Rename : Pending)
+	{
+		SourceRenames.Emplace(Rename.Key->GetFName(), Rename.Value);
+	}
+
+	// Renamed morphs first move to temporary names so names swapped between two morphs never collide
+	const ERenameFlags Flags = REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty | REN_ForceNoResetLoaders;
+	for (const TPair<UMorphTarget*, FName>& Rename : Pending)
+	{
+		Rename.Key->Rename(*MakeUniqueObjectName(InMesh, UMorphTarget::StaticClass(), TEXT("MorphRename")).ToString(), InMesh, Flags);
+	}
+	for (const TPair<UMorphTarget*, FName>& Rename : Pending)
+	{
+		Rename.Key->Rename(*Rename.Value.ToString(), InMesh, Flags);
+	}
+	OutNumRenamed = Pending.Num();
+
+	if (OutNumRenamed > 0)
+	{
+		RenameSourceMorphTargets(InMesh, SourceRenames);
+		// The name -> index lookup used by FindMorphTarget is rebuilt once for all renames
+		InMesh->InitMorphTargets();
+		// Mark the mesh as modified so the names are saved
+		InMesh->MarkPackageDirty();
+	}
+	bIsSuccessful = NumBlocked == 0;
+	OutMessage = FString::Printf(TEXT("Renamed %d morph target(s) on %s"), OutNumRenamed, *InMesh->GetName());
+	if (NumBlocked > 0)
+	{
+		OutMessage += FString::Printf(TEXT(", %d skipped because another morph target already has the name"), NumBlocked);
+	}
+}
+
+FString FBridgeMorphPruneResult::ToString(const FString& MeshName) const
+{
+	return FString::Printf(TEXT("Pruned %s: removed %d of %d morph target(s), stripped %d negligible delta(s), saved %.1f KB"),
+	                       *MeshName, NumRemoved, NumMorphTargets, NumStripped, BytesSaved / 1024.0);
+}
+
+bool UBridgeManager::PruneSourceMorphTargets(USkeletalMesh* InMesh, float InThreshold, const TArray<FString>& InKeepNames,
+                                             FBridgeMorphPruneResult& OutResult)
+{
+	OutResult = FBridgeMorphPruneResult();
+	if (!InMesh)
+	{
+		return false;
+	}
+
+	// Imported morph targets may carry the sanitized form of a name
+	TSet<FName> KeepNames;
+	for (const FString& Name : InKeepNames)
+	{
+		KeepNames.Add(FName(*Name));
+		KeepNames.Add(FName(*ObjectTools::SanitizeObjectName(Name)));
+	}
+
+	// Pruned in the source mesh descriptions the morph targets are built from; the built morph LOD models
+	// would be regenerated from them by the next build. A vertex delta is kept when its position or the
+	// normal of any of its vertex instances changes by more than the threshold, otherwise it is zeroed,
+	// which the build skips
+	const float PositionThresholdSq = InThreshold * InThreshold;
+	const float NormalThresholdSq = 1.0e-6f;
+	TMap<FName, int32> NumKeptByName;
+	TArray<int32> ChangedLODs;
+	for (int32 LODIdx = 0; LODIdx < InMesh->GetLODNum(); LODIdx++)
+	{
+		FMeshDescription* MeshDescription = InMesh->GetMeshDescription(LODIdx);
+		if (!MeshDescription)
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Preserving pre-existing skeleton: %s"), *OldSkeleton->GetPathName());
+			continue;
 		}
-		
-		// Delete the old physics asset ONLY if it was auto-generated during this import
-		// Pre-existing physics assets should be preserved
-		if (OldPhysicsAsset && InImportResult.bNewPhysicsAssetGenerated)
+		FSkeletalMeshAttributes Attributes(*MeshDescription);
+		bool bChanged = false;
+		for (const FName MorphName : Attributes.GetMorphTargetNames())
 		{
-			FString OldPhysicsPath = OldPhysicsAsset->GetPathName();
-			
-			// Additional safety check: only delete if the path matches the generated path
-			if (OldPhysicsPath == InImportResult.GeneratedPhysicsAssetPath)
+			int32& NumKept = NumKeptByName.FindOrAdd(MorphName);
+			TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexMorphPositionDelta(MorphName);
+			TVertexInstanceAttributesRef<FVector3f> Normals;
+			if (Attributes.HasMorphTargetNormalsAttribute(MorphName))
 			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Deleting auto-generated physics asset: %s"), *OldPhysicsPath);
-				
-				// Close any editors using this asset
-				GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(OldPhysicsAsset);
-				
-				// Delete the asset
-				bool bDeleted = UEditorAssetLibrary::DeleteAsset(OldPhysicsPath);
-				if (bDeleted)
+				Normals = Attributes.GetVertexInstanceMorphNormalDelta(MorphName);
+			}
+			for (const FVertexID VertexID : MeshDescription->Vertices().GetElementIDs())
+			{
+				const float PositionSq = Positions.Get(VertexID).SizeSquared();
+				bool bSignificant = PositionSq > PositionThresholdSq;
+				bool bMoves = PositionSq > 0.0f;
+				const TArrayView<const FVertexInstanceID> InstanceIDs = MeshDescription->GetVertexVertexInstanceIDs(VertexID);
+				if (Normals.IsValid())
+				{
+					for (const FVertexInstanceID InstanceID : InstanceIDs)
+					{
+						const float NormalSq = Normals.Get(InstanceID).SizeSquared();
+						bSignificant |= NormalSq > NormalThresholdSq;
+						bMoves |= NormalSq > 0.0f;
+					}
+				}
+				if (bSignificant)
 				{
-					UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Successfully deleted auto-generated physics asset"));
+					NumKept++;
 				}
-				else
+				else if (bMoves)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("AssetsBridge: Failed to delete auto-generated physics asset"));
+					Positions.Set(VertexID, FVector3f::ZeroVector);
+					if (Normals.IsValid())
+					{
+						for (const FVertexInstanceID InstanceID : InstanceIDs)
+						{
+							Normals.Set(InstanceID, FVector3f::ZeroVector);
+						}
+					}
+					OutResult.NumStripped++;
+					bChanged = true;
 				}
 			}
-			else
-			{
-				UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Preserving physics asset (path mismatch - may be pre-existing): %s"), *OldPhysicsPath);
-			}
 		}
-		else if (OldPhysicsAsset)
+		if (bChanged)
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Preserving pre-existing physics asset: %s"), *OldPhysicsAsset->GetPathName());
+			ChangedLODs.Add(LODIdx);
 		}
 	}
-	
+	OutResult.NumMorphTargets = NumKeptByName.Num();
+
+	// Morph targets without a significant delta in any LOD are dropped from every LOD
+	TArray<FName> Removed;
+	for (const TPair<FName, int32>& Kept : NumKeptByName)
+	{
+		if (Kept.Value == 0 && !KeepNames.Contains(Kept.Key))
+		{
+			Removed.Add(Kept.Key);
+		}
+	}
+	if (Removed.Num() > 0)
+	{
+		for (int32 LODIdx = 0; LODIdx < InMesh->GetLODNum(); LODIdx++)
+		{
+			FMeshDescription* MeshDescription = InMesh->GetMeshDescription(LODIdx);
+			if (!MeshDescription)
+			{
+				continue;
+			}
+			FSkeletalMeshAttributes Attributes(*MeshDescription);
+			const TArray<FName> MorphNames = Attributes.GetMorphTargetNames();
+			for (const FName MorphName : Removed)
+			{
+				if (MorphNames.Contains(MorphName))
+				{
+					Attributes.UnregisterMorphTargetAttribute(MorphName);
+					ChangedLODs.AddUnique(LODIdx);
+				}
+			}
+		}
+	}
+	OutResult.NumRemoved = Removed.Num();
+	OutResult.BytesSaved = static_cast<int64>(OutResult.NumStripped) * sizeof(FMorphTargetDelta);
+
+	for (const int32 LODIdx : ChangedLODs)
+	{
+		InMesh->CommitMeshDescription(LODIdx);
+	}
+	return ChangedLODs.Num() > 0;
+}
+
+void UBridgeManager::PruneMorphTargets(USkeletalMesh* InMesh, float InThreshold, const TArray<FString>& InKeepNames, int32& OutNumRemoved,
+                                       int64& OutBytesSaved, bool& bIsSuccessful, FString& OutMessage)
+{
+	OutNumRemoved = 0;
+	OutBytesSaved = 0;
+	if (!InMesh)
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("No mesh to prune morph targets on");
+		return;
+	}
+
+	FBridgeMorphPruneResult Result;
+	if (PruneSourceMorphTargets(InMesh, InThreshold, InKeepNames, Result))
+	{
+		// Rebuilds the mesh, its morph targets and render data once for every change
+		InMesh->PostEditChange();
+		InMesh->MarkPackageDirty();
+	}
+	if (Result.NumMorphTargets == 0)
+	{
+		bIsSuccessful = false;
+		OutMessage = FString::Printf(TEXT("%s has no source morph targets to prune"), *InMesh->GetName());
+		return;
+	}
+	OutNumRemoved = Result.NumRemoved;
+	OutBytesSaved = Result.BytesSaved;
 	bIsSuccessful = true;
-	OutMessage = FString::Printf(TEXT("Successfully retargeted mesh to skeleton: %s"), *IntendedSkeleton->GetName());
-	
-	// Show notification to user
-	UAssetsBridgeTools::ShowNotification(OutMessage);
+	OutMessage = Result.ToString(InMesh->GetName());
 }
 
 UObject* UBridgeManager::RelocateImportedAsset(UObject* InImportedAsset, const FString& InIntendedPath, bool& bIsSuccessful, FString& OutMessage)
 {
+	BRIDGE_STAGE_SCOPE("Relocation");
 	if (!InImportedAsset)
 	{
 		bIsSuccessful = false;
@@ -1296,14 +3068,14 @@ UObject* UBridgeManager::RelocateImportedAsset(UObject* InImportedAsset, const F
 	FString IntendedPackagePath = InIntendedPath;
 	FString IntendedFullPath = IntendedPackagePath + TEXT(".") + AssetName;
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Checking if relocation needed"));
-	UE_LOG(LogTemp, Log, TEXT("  Current: %s"), *CurrentPath);
-	UE_LOG(LogTemp, Log, TEXT("  Intended: %s"), *IntendedFullPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("Checking if relocation needed"));
+	UE_LOG(LogAssetsBridge, Log, TEXT("  Current: %s"), *CurrentPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("  Intended: %s"), *IntendedFullPath);
 	
 	// Check if already at correct location
 	if (CurrentPackagePath == IntendedPackagePath)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Asset already at correct location"));
+		UE_LOG(LogAssetsBridge, Log, TEXT("Asset already at correct location"));
 		bIsSuccessful = true;
 		OutMessage = TEXT("Asset already at correct location");
 		return InImportedAsset;
@@ -1315,7 +3087,7 @@ UObject* UBridgeManager::RelocateImportedAsset(UObject* InImportedAsset, const F
 	// Check if destination already exists
 	if (UEditorAssetLibrary::DoesAssetExist(IntendedPackagePath))
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Destination already exists, deleting old asset first"));
+		UE_LOG(LogAssetsBridge, Log, TEXT("Destination already exists, deleting old asset first"));
 		
 		// Load and close editors for existing asset
 		UObject* ExistingAsset = UEditorAssetLibrary::LoadAsset(IntendedPackagePath);
@@ -1334,11 +3106,11 @@ UObject* UBridgeManager::RelocateImportedAsset(UObject* InImportedAsset, const F
 	}
 	
 	// Rename/move the asset to the intended location
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Relocating asset from %s to %s"), *CurrentPackagePath, *IntendedPackagePath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("Relocating asset from %s to %s"), *CurrentPackagePath, *IntendedPackagePath);
 	
 	if (UEditorAssetLibrary::RenameAsset(CurrentPackagePath, IntendedPackagePath))
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Asset relocated successfully"));
+		UE_LOG(LogAssetsBridge, Log, TEXT("Asset relocated successfully"));
 		
 		// Clean up empty folders
 		CleanupEmptyInterchangeFolders(OriginalFolder);
@@ -1373,7 +3145,7 @@ void UBridgeManager::CleanupEmptyInterchangeFolders(const FString& InFolderPath)
 		return;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Checking folder for cleanup: %s"), *InFolderPath);
+	UE_LOG(LogAssetsBridge, Log, TEXT("Checking folder for cleanup: %s"), *InFolderPath);
 	
 	// Get all assets in this folder (non-recursive)
 	TArray<FString> AssetsInFolder = UEditorAssetLibrary::ListAssets(InFolderPath, false, false);
@@ -1381,11 +3153,11 @@ void UBridgeManager::CleanupEmptyInterchangeFolders(const FString& InFolderPath)
 	if (AssetsInFolder.Num() == 0)
 	{
 		// Folder is empty, try to delete it
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Folder is empty, attempting to delete: %s"), *InFolderPath);
+		UE_LOG(LogAssetsBridge, Log, TEXT("Folder is empty, attempting to delete: %s"), *InFolderPath);
 		
 		if (UEditorAssetLibrary::DeleteDirectory(InFolderPath))
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Successfully deleted empty folder: %s"), *InFolderPath);
+			UE_LOG(LogAssetsBridge, Log, TEXT("Successfully deleted empty folder: %s"), *InFolderPath);
 			
 			// Recursively check parent folder
 			FString ParentFolder = FPaths::GetPath(InFolderPath);
@@ -1396,11 +3168,11 @@ void UBridgeManager::CleanupEmptyInterchangeFolders(const FString& InFolderPath)
 		}
 		else
 		{
-			UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Could not delete folder (may have subfolders): %s"), *InFolderPath);
+			UE_LOG(LogAssetsBridge, Log, TEXT("Could not delete folder (may have subfolders): %s"), *InFolderPath);
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("AssetsBridge: Folder not empty (%d assets), skipping: %s"), AssetsInFolder.Num(), *InFolderPath);
+		UE_LOG(LogAssetsBridge, Log, TEXT("Folder not empty (%d assets), skipping: %s"), AssetsInFolder.Num(), *InFolderPath);
 	}
 }
@@ -0,0 +1,571 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeManifest.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+using FManifestReader = TJsonReader<UTF8CHAR>;
+
+namespace
+{
+	bool IsKey(const FString& Key, const TCHAR* Name)
+	{
+		return Key.Equals(Name, ESearchCase::IgnoreCase);
+	}
+
+	/** Skips the value that was just read, including any nested object or array. */
+	bool SkipValue(FManifestReader& Reader, EJsonNotation Notation)
+	{
+		if (Notation == EJsonNotation::ObjectStart)
+		{
+			return Reader.SkipObject();
+		}
+		if (Notation == EJsonNotation::ArrayStart)
+		{
+			return Reader.SkipArray();
+		}
+		return Notation != EJsonNotation::Error;
+	}
+
+	/**
+	 * Runs OnField for every member of an object whose ObjectStart has already been read.
+	 * OnField receives the member name and the notation of its value and must consume the value.
+	 */
+	bool ReadObject(FManifestReader& Reader, TFunctionRef<bool(const FString&, EJsonNotation)> OnField)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+			if (Notation == EJsonNotation::Error || !OnField(Reader.GetIdentifier(), Notation))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	/** Runs OnElement for every element of an array whose ArrayStart has already been read. */
+	bool ReadArray(FManifestReader& Reader, TFunctionRef<bool(EJsonNotation)> OnElement)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ArrayEnd)
+			{
+				return true;
+			}
+			if (Notation == EJsonNotation::Error || !OnElement(Notation))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	bool ReadString(FManifestReader& Reader, EJsonNotation Notation, FString& OutValue)
+	{
+		if (Notation == EJsonNotation::String)
+		{
+			OutValue = Reader.GetValueAsString();
+			return true;
+		}
+		return Notation == EJsonNotation::Null;
+	}
+
+	bool ReadInt(FManifestReader& Reader, EJsonNotation Notation, int32& OutValue)
+	{
+		if (Notation == EJsonNotation::Number)
+		{
+			OutValue = FMath::TruncToInt32(Reader.GetValueAsNumber());
+			return true;
+		}
+		return Notation == EJsonNotation::Null;
+	}
+
+	bool ReadVector(FManifestReader& Reader, EJsonNotation Notation, FVector& OutValue)
+	{
+		// FJsonObjectConverter writes vectors as {"x":..,"y":..,"z":..} but accepts the ImportText form too
+		if (Notation == EJsonNotation::String)
+		{
+			return OutValue.InitFromString(Reader.GetValueAsString());
+		}
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutValue](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (ValueNotation != EJsonNotation::Number)
+			{
+				return SkipValue(Reader, ValueNotation);
+			}
+			if (IsKey(Key, TEXT("x"))) OutValue.X = Reader.GetValueAsNumber();
+			else if (IsKey(Key, TEXT("y"))) OutValue.Y = Reader.GetValueAsNumber();
+			else if (IsKey(Key, TEXT("z"))) OutValue.Z = Reader.GetValueAsNumber();
+			return true;
+		});
+	}
+
+	bool ReadStringArray(FManifestReader& Reader, EJsonNotation Notation, TArray<FString>& OutValues)
+	{
+		if (Notation != EJsonNotation::ArrayStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadArray(Reader, [&Reader, &OutValues](EJsonNotation ElementNotation)
+		{
+			return ReadString(Reader, ElementNotation, OutValues.AddDefaulted_GetRef());
+		});
+	}
+
+	/** Reads an array of objects, calling ReadElement on a fresh element for each one. */
+	template <typename StructType>
+	bool ReadStructArray(FManifestReader& Reader, EJsonNotation Notation, TArray<StructType>& OutValues,
+	                     bool (*ReadElement)(FManifestReader&, EJsonNotation, StructType&))
+	{
+		if (Notation != EJsonNotation::ArrayStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadArray(Reader, [&Reader, &OutValues, ReadElement](EJsonNotation ElementNotation)
+		{
+			return ReadElement(Reader, ElementNotation, OutValues.AddDefaulted_GetRef());
+		});
+	}
+
+	bool ReadMaterialSlot(FManifestReader& Reader, EJsonNotation Notation, FMaterialSlot& OutSlot)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutSlot](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("name"))) return ReadString(Reader, ValueNotation, OutSlot.Name);
+			if (IsKey(Key, TEXT("idx"))) return ReadInt(Reader, ValueNotation, OutSlot.Idx);
+			if (IsKey(Key, TEXT("internalPath"))) return ReadString(Reader, ValueNotation, OutSlot.InternalPath);
+			if (IsKey(Key, TEXT("originalIdx"))) return ReadInt(Reader, ValueNotation, OutSlot.OriginalIdx);
+			return SkipValue(Reader, ValueNotation);
+		});
+	}
+
+	bool ReadMaterialChangeset(FManifestReader& Reader, EJsonNotation Notation, FMaterialChangeset& OutChangeset)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutChangeset](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("added"))) return ReadStructArray(Reader, ValueNotation, OutChangeset.Added, &ReadMaterialSlot);
+			if (IsKey(Key, TEXT("removed"))) return ReadStructArray(Reader, ValueNotation, OutChangeset.Removed, &ReadMaterialSlot);
+			if (IsKey(Key, TEXT("unchanged"))) return ReadStructArray(Reader, ValueNotation, OutChangeset.Unchanged, &ReadMaterialSlot);
+			return SkipValue(Reader, ValueNotation);
+		});
+	}
+
+	bool ReadWorldData(FManifestReader& Reader, EJsonNotation Notation, FWorldData& OutWorldData)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutWorldData](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("rotation"))) return ReadVector(Reader, ValueNotation, OutWorldData.Rotation);
+			if (IsKey(Key, TEXT("location"))) return ReadVector(Reader, ValueNotation, OutWorldData.Location);
+			if (IsKey(Key, TEXT("scale"))) return ReadVector(Reader, ValueNotation, OutWorldData.Scale);
+			return SkipValue(Reader, ValueNotation);
+		});
+	}
+
+	bool ReadTexture(FManifestReader& Reader, EJsonNotation Notation, FBridgeTexture& OutTexture)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutTexture](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("file"))) return ReadString(Reader, ValueNotation, OutTexture.File);
+			if (IsKey(Key, TEXT("contentPath"))) return ReadString(Reader, ValueNotation, OutTexture.ContentPath);
+			return SkipValue(Reader, ValueNotation);
+		});
+	}
+
+	bool ReadTextureSet(FManifestReader& Reader, EJsonNotation Notation, FBridgeTextureSet& OutSet)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutSet](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("baseColor"))) return ReadTexture(Reader, ValueNotation, OutSet.BaseColor);
+			if (IsKey(Key, TEXT("orm"))) return ReadTexture(Reader, ValueNotation, OutSet.Orm);
+			if (IsKey(Key, TEXT("normal"))) return ReadTexture(Reader, ValueNotation, OutSet.Normal);
+			if (IsKey(Key, TEXT("emissive"))) return ReadTexture(Reader, ValueNotation, OutSet.Emissive);
+			if (IsKey(Key, TEXT("master"))) return ReadString(Reader, ValueNotation, OutSet.Master);
+			if (IsKey(Key, TEXT("materialInstance"))) return ReadString(Reader, ValueNotation, OutSet.MaterialInstance);
+			return SkipValue(Reader, ValueNotation);
+		});
+	}
+
+	bool ReadExportAsset(FManifestReader& Reader, EJsonNotation Notation, FExportAsset& OutAsset)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return Notation == EJsonNotation::Null;
+		}
+		return ReadObject(Reader, [&Reader, &OutAsset](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("model"))) return ReadString(Reader, ValueNotation, OutAsset.Model);
+			if (IsKey(Key, TEXT("objectId"))) return ReadString(Reader, ValueNotation, OutAsset.ObjectID);
+			if (IsKey(Key, TEXT("objectMaterials"))) return ReadStructArray(Reader, ValueNotation, OutAsset.ObjectMaterials, &ReadMaterialSlot);
+			if (IsKey(Key, TEXT("materialChangeset"))) return ReadMaterialChangeset(Reader, ValueNotation, OutAsset.MaterialChangeset);
+			if (IsKey(Key, TEXT("internalPath"))) return ReadString(Reader, ValueNotation, OutAsset.InternalPath);
+			if (IsKey(Key, TEXT("relativeExportPath"))) return ReadString(Reader, ValueNotation, OutAsset.RelativeExportPath);
+			if (IsKey(Key, TEXT("shortName"))) return ReadString(Reader, ValueNotation, OutAsset.ShortName);
+			if (IsKey(Key, TEXT("exportLocation"))) return ReadString(Reader, ValueNotation, OutAsset.ExportLocation);
+			if (IsKey(Key, TEXT("stringType"))) return ReadString(Reader, ValueNotation, OutAsset.StringType);
+			if (IsKey(Key, TEXT("skeleton"))) return ReadString(Reader, ValueNotation, OutAsset.Skeleton);
+			if (IsKey(Key, TEXT("morphTargets"))) return ReadStringArray(Reader, ValueNotation, OutAsset.MorphTargets);
+			if (IsKey(Key, TEXT("keepEmptyMorphTargets"))) return ReadStringArray(Reader, ValueNotation, OutAsset.KeepEmptyMorphTargets);
+			if (IsKey(Key, TEXT("worldData"))) return ReadWorldData(Reader, ValueNotation, OutAsset.WorldData);
+			if (IsKey(Key, TEXT("textures"))) return ReadTextureSet(Reader, ValueNotation, OutAsset.Textures);
+			// modelPtr is runtime only and anything else is from a newer addon
+			return SkipValue(Reader, ValueNotation);
+		});
+	}
+
+	/** FString keys hash case-insensitively by default, but the string table must keep "Mesh" and "mesh" apart. */
+	struct FCaseSensitiveStringKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+	{
+		static const FString& GetSetKey(const TPair<FString, uint32>& Element)
+		{
+			return Element.Key;
+		}
+
+		static bool Matches(const FString& A, const FString& B)
+		{
+			return A.Equals(B, ESearchCase::CaseSensitive);
+		}
+
+		static uint32 GetKeyHash(const FString& Key)
+		{
+			return FCrc::StrCrc32(*Key);
+		}
+	};
+
+	/**
+	 * Serializes the manifest body in either direction. Strings go through the string table so the
+	 * body only carries indices; the same code path is used for loading and saving to keep them in sync.
+	 */
+	struct FBinaryManifestArchive
+	{
+		FArchive& Ar;
+		TArray<FString> Strings;
+		TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> StringLookup;
+
+		explicit FBinaryManifestArchive(FArchive& InAr)
+			: Ar(InAr)
+		{
+		}
+
+		void String(FString& Value)
+		{
+			if (Ar.IsLoading())
+			{
+				uint32 Index = 0;
+				Ar << Index;
+				if (!Strings.IsValidIndex(Index))
+				{
+					Ar.SetError();
+					return;
+				}
+				Value = Strings[Index];
+				return;
+			}
+			uint32 Index;
+			if (const uint32* Found = StringLookup.Find(Value))
+			{
+				Index = *Found;
+			}
+			else
+			{
+				Index = Strings.Add(Value);
+				StringLookup.Add(Value, Index);
+			}
+			Ar << Index;
+		}
+
+		void Int(int32& Value)
+		{
+			Ar << Value;
+		}
+
+		void Vector(FVector& Value)
+		{
+			Ar << Value.X << Value.Y << Value.Z;
+		}
+
+		template <typename ElementType, typename FunctorType>
+		void Array(TArray<ElementType>& Values, FunctorType&& SerializeElement)
+		{
+			uint32 Num = Values.Num();
+			Ar << Num;
+			if (Ar.IsLoading())
+			{
+				// Every element takes at least one byte, so a larger count can only come from a corrupt file
+				if (Ar.IsError() || Num > static_cast<uint64>(Ar.TotalSize() - Ar.Tell()))
+				{
+					Ar.SetError();
+					return;
+				}
+				Values.SetNum(Num);
+			}
+			for (ElementType& Value : Values)
+			{
+				if (Ar.IsError())
+				{
+					return;
+				}
+				SerializeElement(Value);
+			}
+		}
+
+		void MaterialSlot(FMaterialSlot& Slot)
+		{
+			String(Slot.Name);
+			Int(Slot.Idx);
+			String(Slot.InternalPath);
+			Int(Slot.OriginalIdx);
+		}
+
+		void MaterialSlots(TArray<FMaterialSlot>& Slots)
+		{
+			Array(Slots, [this](FMaterialSlot& Slot) { MaterialSlot(Slot); });
+		}
+
+		void Texture(FBridgeTexture& Texture)
+		{
+			String(Texture.File);
+			String(Texture.ContentPath);
+		}
+
+		void ExportAsset(FExportAsset& Asset)
+		{
+			String(Asset.Model);
+			String(Asset.ObjectID);
+			MaterialSlots(Asset.ObjectMaterials);
+			MaterialSlots(Asset.MaterialChangeset.Added);
+			MaterialSlots(Asset.MaterialChangeset.Removed);
+			MaterialSlots(Asset.MaterialChangeset.Unchanged);
+			String(Asset.InternalPath);
+			String(Asset.RelativeExportPath);
+			String(Asset.ShortName);
+			String(Asset.ExportLocation);
+			String(Asset.StringType);
+			String(Asset.Skeleton);
+			Array(Asset.MorphTargets, [this](FString& Name) { String(Name); });
+			Array(Asset.KeepEmptyMorphTargets, [this](FString& Name) { String(Name); });
+			Vector(Asset.WorldData.Rotation);
+			Vector(Asset.WorldData.Location);
+			Vector(Asset.WorldData.Scale);
+			Texture(Asset.Textures.BaseColor);
+			Texture(Asset.Textures.Orm);
+			Texture(Asset.Textures.Normal);
+			Texture(Asset.Textures.Emissive);
+			String(Asset.Textures.Master);
+			String(Asset.Textures.MaterialInstance);
+		}
+
+		void Export(FBridgeExport& Data)
+		{
+			String(Data.Operation);
+			Array(Data.Objects, [this](FExportAsset& Asset) { ExportAsset(Asset); });
+		}
+	};
+}
+
+void UBridgeManifest::ReadFile(const FString& FilePath, FBridgeExport& OutData, bool& bIsSuccessful, FString& OutMessage)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		bIsSuccessful = false;
+		OutMessage = FString::Printf(TEXT("unable to read file: '%s'"), *FilePath);
+		return;
+	}
+
+	if (IsBinary(FileData))
+	{
+		ParseBinary(FileData, OutData, bIsSuccessful, OutMessage);
+	}
+	else
+	{
+		// Blender writes plain UTF-8 but tolerate a byte order mark from hand edited files
+		int32 Offset = 0;
+		if (FileData.Num() >= 3 && FileData[0] == 0xEF && FileData[1] == 0xBB && FileData[2] == 0xBF)
+		{
+			Offset = 3;
+		}
+		ParseJson(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(FileData.GetData()) + Offset, FileData.Num() - Offset),
+		          OutData, bIsSuccessful, OutMessage);
+	}
+	if (bIsSuccessful)
+	{
+		OutMessage = FString::Printf(TEXT("Read %d objects from %s"), OutData.Objects.Num(), *FilePath);
+	}
+}
+
+bool UBridgeManifest::IsBinary(TConstArrayView<uint8> Data)
+{
+	return Data.Num() >= 4 && (Data[0] | (Data[1] << 8) | (Data[2] << 16) | (Data[3] << 24)) == BinaryMagic;
+}
+
+FString UBridgeManifest::GetFormatPath(const FString& FilePath, bool bBinary)
+{
+	return FPaths::ChangeExtension(FilePath, bBinary ? BinaryExtension : TEXT("json"));
+}
+
+FString UBridgeManifest::ResolveReadPath(const FString& FilePath)
+{
+	const FString Extension = FPaths::GetExtension(FilePath);
+	const bool bIsJsonPath = Extension.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	if (!bIsJsonPath && !Extension.Equals(BinaryExtension, ESearchCase::IgnoreCase))
+	{
+		return FilePath;
+	}
+	const FString Sibling = GetFormatPath(FilePath, bIsJsonPath);
+	// A missing file reports FDateTime::MinValue, so this also covers either one being absent
+	IFileManager& FileManager = IFileManager::Get();
+	return FileManager.GetTimeStamp(*Sibling) > FileManager.GetTimeStamp(*FilePath) ? Sibling : FilePath;
+}
+
+void UBridgeManifest::ParseBinary(TConstArrayView<uint8> Data, FBridgeExport& OutData, bool& bIsSuccessful, FString& OutMessage)
+{
+	OutData = FBridgeExport();
+	if (!IsBinary(Data))
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("not a binary manifest");
+		return;
+	}
+
+	FMemoryReaderView Reader(Data);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Reader.IsError())
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("binary manifest is truncated before its version");
+		return;
+	}
+	if (Version != BinaryVersion)
+	{
+		bIsSuccessful = false;
+		OutMessage = FString::Printf(TEXT("unsupported binary manifest version %u (expected %u)"), Version, BinaryVersion);
+		return;
+	}
+
+	FBinaryManifestArchive Archive(Reader);
+	uint32 NumStrings = 0;
+	Reader << NumStrings;
+	if (NumStrings > static_cast<uint64>(Reader.TotalSize() - Reader.Tell()))
+	{
+		Reader.SetError();
+	}
+	else
+	{
+		Archive.Strings.Reserve(NumStrings);
+	}
+	for (uint32 Idx = 0; Idx < NumStrings && !Reader.IsError(); Idx++)
+	{
+		uint32 Len = 0;
+		Reader << Len;
+		if (Reader.IsError() || Len > static_cast<uint64>(Reader.TotalSize() - Reader.Tell()))
+		{
+			Reader.SetError();
+			break;
+		}
+		Archive.Strings.Emplace(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data.GetData() + Reader.Tell()), Len));
+		Reader.Seek(Reader.Tell() + Len);
+	}
+
+	if (!Reader.IsError())
+	{
+		Archive.Export(OutData);
+	}
+	if (Reader.IsError())
+	{
+		bIsSuccessful = false;
+		OutMessage = TEXT("binary manifest is truncated or corrupt");
+		OutData = FBridgeExport();
+		return;
+	}
+	bIsSuccessful = true;
+	OutMessage = FString::Printf(TEXT("Parsed %d objects"), OutData.Objects.Num());
+}
+
+void UBridgeManifest::WriteBinary(const FBridgeExport& Data, TArray<uint8>& OutBytes)
+{
+	// The body is written first so the string table is complete before it goes in front of it
+	TArray<uint8> Body;
+	FMemoryWriter BodyWriter(Body);
+	FBinaryManifestArchive Archive(BodyWriter);
+	// Saving only reads from the struct, the archive just shares its signature with loading
+	Archive.Export(const_cast<FBridgeExport&>(Data));
+
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+	uint32 Magic = BinaryMagic;
+	uint32 Version = BinaryVersion;
+	uint32 NumStrings = Archive.Strings.Num();
+	Writer << Magic << Version << NumStrings;
+	for (const FString& Value : Archive.Strings)
+	{
+		FTCHARToUTF8 Utf8(*Value, Value.Len());
+		uint32 Len = Utf8.Length();
+		Writer << Len;
+		Writer.Serialize(const_cast<void*>(static_cast<const void*>(Utf8.Get())), Len);
+	}
+	Writer.Serialize(Body.GetData(), Body.Num());
+}
+
+void UBridgeManifest::ParseJson(FUtf8StringView Utf8Data, FBridgeExport& OutData, bool& bIsSuccessful, FString& OutMessage)
+{
+	TSharedRef<FManifestReader> ReaderRef = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Utf8Data);
+	FManifestReader& Reader = ReaderRef.Get();
+	OutData = FBridgeExport();
+
+	EJsonNotation Notation;
+	bIsSuccessful = Reader.ReadNext(Notation) && Notation == EJsonNotation::ObjectStart &&
+		ReadObject(Reader, [&Reader, &OutData](const FString& Key, EJsonNotation ValueNotation)
+		{
+			if (IsKey(Key, TEXT("operation"))) return ReadString(Reader, ValueNotation, OutData.Operation);
+			if (IsKey(Key, TEXT("objects"))) return ReadStructArray(Reader, ValueNotation, OutData.Objects, &ReadExportAsset);
+			return SkipValue(Reader, ValueNotation);
+		});
+
+	if (!bIsSuccessful)
+	{
+		const FString& ReaderError = Reader.GetErrorMessage();
+		OutMessage = ReaderError.IsEmpty()
+			             ? FString(TEXT("unexpected value type in manifest"))
+			             : FString::Printf(TEXT("failed to parse manifest: %s"), *ReaderError);
+		OutData = FBridgeExport();
+		return;
+	}
+	OutMessage = FString::Printf(TEXT("Parsed %d objects"), OutData.Objects.Num());
+}
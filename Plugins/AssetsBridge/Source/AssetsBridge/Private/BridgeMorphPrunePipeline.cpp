@@ -0,0 +1,44 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeMorphPrunePipeline.h"
+
+#include "AssetsBridge.h"
+#include "BridgeManager.h"
+#include "BridgeStats.h"
+#include "Engine/SkeletalMesh.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+	/** Results of the pipelines that ran, until FinalizeImportJob takes them; only touched on the game thread */
+	TMap<TObjectKey<UObject>, FBridgeMorphPruneResult> GPruneResults;
+}
+
+bool UBridgeMorphPrunePipeline::TakePruneResult(const UObject* Mesh, FBridgeMorphPruneResult& OutResult)
+{
+	return Mesh && GPruneResults.RemoveAndCopyValue(TObjectKey<UObject>(Mesh), OutResult);
+}
+
+void UBridgeMorphPrunePipeline::ExecutePostFactoryPipeline(const UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& FactoryNodeKey,
+                                                           UObject* CreatedAsset, bool bIsAReimport)
+{
+	USkeletalMesh* Mesh = Cast<USkeletalMesh>(CreatedAsset);
+	if (!Mesh)
+	{
+		return;
+	}
+	BRIDGE_STAGE_SCOPE("Morph Prune");
+	FBridgeMorphPruneResult Result;
+	// Only the mesh descriptions are edited here; the build that follows the post factory pipelines picks them up
+	UBridgeManager::PruneSourceMorphTargets(Mesh, Threshold, KeepNames, Result);
+	if (Result.NumMorphTargets > 0)
+	{
+		GPruneResults.Add(TObjectKey<UObject>(Mesh), Result);
+	}
+}
+
+bool UBridgeMorphPrunePipeline::CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask)
+{
+	// Edits the mesh descriptions of the created asset, which is only safe on the game thread
+	return false;
+}
@@ -0,0 +1,282 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeSkeletonIndex.h"
+
+#include "AssetsBridge.h"
+#include "AssetsBridgeTools.h"
+#include "BridgeStats.h"
+#include "Animation/Skeleton.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "EditorAssetLibrary.h"
+#include "Hash/xxhash.h"
+#include "UObject/MetaData.h"
+
+const FName UBridgeSkeletonIndex::FingerprintTag(TEXT("AssetsBridge.BoneFingerprint"));
+const FName UBridgeSkeletonIndex::HierarchyTag(TEXT("AssetsBridge.BoneHierarchy"));
+
+/** "bone>parent" pairs sorted by bone, the canonical form both tags are built from. */
+static FString GetHierarchyString(const TArray<FBridgeBoneLink>& Bones)
+{
+	TArray<FString> Links;
+	Links.Reserve(Bones.Num());
+	for (const FBridgeBoneLink& Link : Bones)
+	{
+		// FName compares case-insensitively, so the stored form does as well
+		Links.Add(Link.Bone.ToString().ToLower() + TEXT(">") + (Link.Parent.IsNone() ? FString() : Link.Parent.ToString().ToLower()));
+	}
+	Links.Sort();
+	return FString::Join(Links, TEXT(";"));
+}
+
+FBridgeSkeletonIndex FBridgeSkeletonIndex::Build()
+{
+	BRIDGE_STAGE_SCOPE("Skeleton Index");
+	FBridgeSkeletonIndex Index;
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> Skeletons;
+	AssetRegistry.GetAssetsByClass(USkeleton::StaticClass()->GetClassPathName(), Skeletons);
+
+	for (const FAssetData& Asset : Skeletons)
+	{
+		FString Fingerprint;
+		FString Hierarchy;
+		if (!Asset.GetTagValue(UBridgeSkeletonIndex::FingerprintTag, Fingerprint) || !Asset.GetTagValue(UBridgeSkeletonIndex::HierarchyTag, Hierarchy))
+		{
+			continue;
+		}
+		TArray<FString> Links;
+		Hierarchy.ParseIntoArray(Links, TEXT(";"));
+		TArray<FBridgeBoneLink> Bones;
+		Bones.Reserve(Links.Num());
+		for (const FString& Link : Links)
+		{
+			FString Bone;
+			FString Parent;
+			Link.Split(TEXT(">"), &Bone, &Parent);
+			Bones.Add({FName(*Bone), Parent.IsEmpty() ? NAME_None : FName(*Parent)});
+		}
+		// The tag already holds the fingerprint, no need to hash the hierarchy again
+		Index.Add(Asset.GetSoftObjectPath(), Bones, Fingerprint);
+	}
+	UE_LOG(LogAssetsBridge, Log, TEXT("Skeleton index: %d of %d skeleton(s) tagged"), Index.Entries.Num(), Skeletons.Num());
+	return Index;
+}
+
+void FBridgeSkeletonIndex::Add(const FSoftObjectPath& Path, const TArray<FBridgeBoneLink>& Bones)
+{
+	Add(Path, Bones, UBridgeSkeletonIndex::ComputeFingerprint(Bones));
+}
+
+void FBridgeSkeletonIndex::Add(const FSoftObjectPath& Path, const TArray<FBridgeBoneLink>& Bones, const FString& Fingerprint)
+{
+	const int32 EntryIdx = Entries.AddDefaulted();
+	FEntry& Entry = Entries[EntryIdx];
+	Entry.Path = Path;
+	for (const FBridgeBoneLink& Link : Bones)
+	{
+		Entry.Parents.Add(Link.Bone, Link.Parent);
+		ByBone.Add(Link.Bone, EntryIdx);
+	}
+	// Duplicated skeletons keep the first one added
+	if (!ByFingerprint.Contains(Fingerprint))
+	{
+		ByFingerprint.Add(Fingerprint, EntryIdx);
+	}
+}
+
+FSoftObjectPath FBridgeSkeletonIndex::FindCompatible(const TArray<FBridgeBoneLink>& Bones) const
+{
+	if (Bones.Num() == 0)
+	{
+		return FSoftObjectPath();
+	}
+	if (const int32* Exact = ByFingerprint.Find(UBridgeSkeletonIndex::ComputeFingerprint(Bones)))
+	{
+		return Entries[*Exact].Path;
+	}
+
+	// Only skeletons that contain the first root can contain the whole hierarchy
+	FName Root = Bones[0].Bone;
+	for (const FBridgeBoneLink& Link : Bones)
+	{
+		if (Link.Parent.IsNone())
+		{
+			Root = Link.Bone;
+			break;
+		}
+	}
+	TArray<int32> Candidates;
+	ByBone.MultiFind(Root, Candidates);
+
+	int32 Best = INDEX_NONE;
+	for (const int32 Candidate : Candidates)
+	{
+		const FEntry& Entry = Entries[Candidate];
+		if (Entry.Parents.Num() < Bones.Num() || (Best != INDEX_NONE && Entry.Parents.Num() >= Entries[Best].Parents.Num()))
+		{
+			continue;
+		}
+		bool bContainsAll = true;
+		for (const FBridgeBoneLink& Link : Bones)
+		{
+			const FName* Parent = Entry.Parents.Find(Link.Bone);
+			if (!Parent || (!Link.Parent.IsNone() && *Parent != Link.Parent))
+			{
+				bContainsAll = false;
+				break;
+			}
+		}
+		if (bContainsAll)
+		{
+			Best = Candidate;
+		}
+	}
+	return Best != INDEX_NONE ? Entries[Best].Path : FSoftObjectPath();
+}
+
+void UBridgeSkeletonIndex::RegisterAssetRegistryTags()
+{
+	TSet<FName>& Tags = UMetaData::GetMetaDataTagsForAssetRegistry();
+	Tags.Add(FingerprintTag);
+	Tags.Add(HierarchyTag);
+}
+
+FString UBridgeSkeletonIndex::ComputeFingerprint(const TArray<FBridgeBoneLink>& Bones)
+{
+	const FString Hierarchy = GetHierarchyString(Bones);
+	return FString::Printf(TEXT("%d-%016llx"), Bones.Num(), FXxHash64::HashBuffer(*Hierarchy, Hierarchy.Len() * sizeof(TCHAR)).Hash);
+}
+
+TArray<FBridgeBoneLink> UBridgeSkeletonIndex::GetSkeletonBones(const USkeleton* Skeleton)
+{
+	TArray<FBridgeBoneLink> Bones;
+	if (!Skeleton)
+	{
+		return Bones;
+	}
+	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+	Bones.Reserve(RefSkeleton.GetNum());
+	for (int32 BoneIdx = 0; BoneIdx < RefSkeleton.GetNum(); ++BoneIdx)
+	{
+		const int32 ParentIdx = RefSkeleton.GetParentIndex(BoneIdx);
+		Bones.Add({RefSkeleton.GetBoneName(BoneIdx), ParentIdx != INDEX_NONE ? RefSkeleton.GetBoneName(ParentIdx) : NAME_None});
+	}
+	return Bones;
+}
+
+void UBridgeSkeletonIndex::ReadGltfBones(const FString& FilePath, TArray<FBridgeBoneLink>& OutBones, bool& bIsSuccessful, FString& OutMessage)
+{
+	OutBones.Reset();
+	const TSharedPtr<FJsonObject> Gltf = UAssetsBridgeTools::ReadGltfJson(FilePath, bIsSuccessful, OutMessage);
+	if (!bIsSuccessful)
+	{
+		return;
+	}
+	OutBones = ReadGltfBones(Gltf);
+	OutMessage = FString::Printf(TEXT("Read %d joint(s) from %s"), OutBones.Num(), *FilePath);
+}
+
+TArray<FBridgeBoneLink> UBridgeSkeletonIndex::ReadGltfBones(const TSharedPtr<FJsonObject>& Gltf)
+{
+	TArray<FBridgeBoneLink> Bones;
+	const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* Skins = nullptr;
+	if (!Gltf.IsValid() || !Gltf->TryGetArrayField(TEXT("nodes"), Nodes) || !Gltf->TryGetArrayField(TEXT("skins"), Skins))
+	{
+		return Bones;
+	}
+
+	// glTF only stores children, so invert them once
+	TArray<int32> ParentOf;
+	ParentOf.Init(INDEX_NONE, Nodes->Num());
+	for (int32 NodeIdx = 0; NodeIdx < Nodes->Num(); NodeIdx++)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+		if ((*Nodes)[NodeIdx]->AsObject()->TryGetArrayField(TEXT("children"), Children))
+		{
+			for (const TSharedPtr<FJsonValue>& Child : *Children)
+			{
+				const int32 ChildIdx = static_cast<int32>(Child->AsNumber());
+				if (ParentOf.IsValidIndex(ChildIdx))
+				{
+					ParentOf[ChildIdx] = NodeIdx;
+				}
+			}
+		}
+	}
+
+	TSet<int32> Joints;
+	for (const TSharedPtr<FJsonValue>& Skin : *Skins)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* SkinJoints = nullptr;
+		if (Skin->AsObject()->TryGetArrayField(TEXT("joints"), SkinJoints))
+		{
+			for (const TSharedPtr<FJsonValue>& Joint : *SkinJoints)
+			{
+				const int32 JointIdx = static_cast<int32>(Joint->AsNumber());
+				if (Nodes->IsValidIndex(JointIdx))
+				{
+					Joints.Add(JointIdx);
+				}
+			}
+		}
+	}
+
+	auto GetNodeName = [Nodes](int32 NodeIdx)
+	{
+		FString Name;
+		(*Nodes)[NodeIdx]->AsObject()->TryGetStringField(TEXT("name"), Name);
+		return Name.IsEmpty() ? FName(*FString::Printf(TEXT("Joint_%d"), NodeIdx)) : FName(*Name);
+	};
+	for (const int32 JointIdx : Joints)
+	{
+		// Non-joint nodes between two joints (e.g. the armature object) are not bones
+		int32 ParentIdx = ParentOf[JointIdx];
+		while (ParentIdx != INDEX_NONE && !Joints.Contains(ParentIdx))
+		{
+			ParentIdx = ParentOf[ParentIdx];
+		}
+		Bones.Add({GetNodeName(JointIdx), ParentIdx != INDEX_NONE ? GetNodeName(ParentIdx) : NAME_None});
+	}
+	return Bones;
+}
+
+bool UBridgeSkeletonIndex::TagSkeleton(USkeleton* Skeleton)
+{
+	if (!Skeleton)
+	{
+		return false;
+	}
+	const TArray<FBridgeBoneLink> Bones = GetSkeletonBones(Skeleton);
+	const FString Fingerprint = ComputeFingerprint(Bones);
+	if (UEditorAssetLibrary::GetMetadataTag(Skeleton, FingerprintTag) == Fingerprint)
+	{
+		return false;
+	}
+	UEditorAssetLibrary::SetMetadataTag(Skeleton, FingerprintTag, Fingerprint);
+	UEditorAssetLibrary::SetMetadataTag(Skeleton, HierarchyTag, GetHierarchyString(Bones));
+	Skeleton->MarkPackageDirty();
+	return true;
+}
+
+int32 UBridgeSkeletonIndex::TagUntaggedSkeletons(bool& bIsSuccessful, FString& OutMessage)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> Skeletons;
+	AssetRegistry.GetAssetsByClass(USkeleton::StaticClass()->GetClassPathName(), Skeletons);
+
+	int32 NumTagged = 0;
+	for (const FAssetData& Asset : Skeletons)
+	{
+		if (Asset.FindTag(FingerprintTag))
+		{
+			continue;
+		}
+		USkeleton* Skeleton = Cast<USkeleton>(Asset.GetAsset());
+		NumTagged += TagSkeleton(Skeleton) ? 1 : 0;
+	}
+	bIsSuccessful = true;
+	OutMessage = FString::Printf(TEXT("Tagged %d of %d skeleton(s); save them to make the tags searchable"), NumTagged, Skeletons.Num());
+	return NumTagged;
+}
@@ -0,0 +1,75 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeStats.h"
+
+#include "AssetsBridge.h"
+
+UE_TRACE_CHANNEL_DEFINE(AssetsBridgeChannel);
+
+static FBridgeOperationStats GCurrentOperation;
+static FBridgeOperationStats GLastOperation;
+static double GOperationStartTime = 0.0;
+static int32 GOperationDepth = 0;
+
+void FBridgeOperationStats::AddStageTime(const TCHAR* Stage, double Seconds)
+{
+	FBridgeStageStats* Found = Stages.FindByPredicate([Stage](const FBridgeStageStats& Existing)
+	{
+		return Existing.Stage.Equals(Stage, ESearchCase::CaseSensitive);
+	});
+	if (!Found)
+	{
+		Found = &Stages.AddDefaulted_GetRef();
+		Found->Stage = Stage;
+	}
+	Found->Count++;
+	Found->Seconds += Seconds;
+}
+
+FString FBridgeOperationStats::ToString() const
+{
+	FString Result = FString::Printf(TEXT("%s took %.3f s"), *Operation, TotalSeconds);
+	for (const FBridgeStageStats& StageStats : Stages)
+	{
+		const double Percent = TotalSeconds > 0.0 ? 100.0 * StageStats.Seconds / TotalSeconds : 0.0;
+		Result += FString::Printf(TEXT("\n  %-20s %8.3f s %5.1f%% x%d"), *StageStats.Stage, StageStats.Seconds, Percent, StageStats.Count);
+	}
+	return Result;
+}
+
+void FBridgeStats::BeginOperation(const FString& Operation)
+{
+	if (GOperationDepth++ > 0)
+	{
+		return;
+	}
+	GCurrentOperation = FBridgeOperationStats();
+	GCurrentOperation.Operation = Operation;
+	GOperationStartTime = FPlatformTime::Seconds();
+}
+
+void FBridgeStats::EndOperation()
+{
+	if (GOperationDepth == 0 || --GOperationDepth > 0)
+	{
+		return;
+	}
+	GCurrentOperation.TotalSeconds = FPlatformTime::Seconds() - GOperationStartTime;
+	GLastOperation = MoveTemp(GCurrentOperation);
+	GCurrentOperation = FBridgeOperationStats();
+	UE_LOG(LogAssetsBridge, Log, TEXT("%s"), *GLastOperation.ToString());
+}
+
+void FBridgeStats::AddStageTime(const TCHAR* Stage, double Seconds)
+{
+	// Stages run outside of an operation (e.g. a direct BuildMaterialInstance call) are only traced
+	if (GOperationDepth > 0)
+	{
+		GCurrentOperation.AddStageTime(Stage, Seconds);
+	}
+}
+
+const FBridgeOperationStats& FBridgeStats::GetLastOperation()
+{
+	return GLastOperation;
+}
@@ -0,0 +1,25 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeTexturePipeline.h"
+
+#include "InterchangeTextureFactoryNode.h"
+#include "Nodes/InterchangeBaseNodeContainer.h"
+
+void UBridgeTexturePipeline::ExecutePipeline(UInterchangeBaseNodeContainer* BaseNodeContainer, const TArray<UInterchangeSourceData*>& SourceDatas,
+                                             const FString& ContentBasePath)
+{
+	if (!BaseNodeContainer)
+	{
+		return;
+	}
+	BaseNodeContainer->IterateNodesOfType<UInterchangeTextureFactoryNode>([this](const FString& NodeUid, UInterchangeTextureFactoryNode* FactoryNode)
+	{
+		FactoryNode->SetCustomSRGB(bSRGB);
+		FactoryNode->SetCustomCompressionSettings(static_cast<uint8>(CompressionSettings.GetValue()));
+		if (bOverrideLODGroup)
+		{
+			FactoryNode->SetCustomLODGroup(static_cast<uint8>(LODGroup.GetValue()));
+		}
+		FactoryNode->SetCustomVirtualTextureStreaming(bVirtualTextureStreaming);
+	});
+}
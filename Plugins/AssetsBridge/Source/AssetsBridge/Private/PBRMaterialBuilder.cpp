@@ -2,6 +2,10 @@
 
 #include "PBRMaterialBuilder.h"
 
+#include "ABSettings.h"
+#include "AssetsBridge.h"
+#include "BridgeStats.h"
+
 #if WITH_EDITOR
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
@@ -13,104 +17,465 @@
 #include "Materials/MaterialParameters.h"
 #include "UObject/SavePackage.h"
 #include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EditorFramework/AssetImportData.h"
+#include "HAL/FileManager.h"
+#include "Misc/SecureHash.h"
+#include "BridgeTexturePipeline.h"
+#include "InterchangeManager.h"
+#include "InterchangeGenericAssetsPipeline.h"
 #endif
 
 // Default master material when neither the manifest nor the caller specify one.
 static const TCHAR* GDefaultMasterPath = TEXT("/Game/Materials/_Core/M_ORM.M_ORM");
 
 #if WITH_EDITOR
-static void ApplyTextureRoleSettings(UTexture2D* Tex, EPBRTextureRole Role)
+/** Texture settings a master-material slot needs. */
+struct FPBRRoleSettings
 {
-	if (!Tex)
-	{
-		return;
-	}
+	bool bSRGB = true;
+	TextureCompressionSettings Compression = TC_Default;
+	TOptional<TextureGroup> LODGroup;
+};
+
+static FPBRRoleSettings GetRoleSettings(EPBRTextureRole Role)
+{
+	FPBRRoleSettings Settings;
 	switch (Role)
 	{
 	case EPBRTextureRole::BaseColor:
-		Tex->SRGB = true;
-		Tex->CompressionSettings = TC_Default;
+	case EPBRTextureRole::Emissive:
 		break;
 	case EPBRTextureRole::ORM:
-		Tex->SRGB = false;
-		Tex->CompressionSettings = TC_Masks;
+		Settings.bSRGB = false;
+		Settings.Compression = TC_Masks;
 		break;
 	case EPBRTextureRole::Normal:
-		Tex->SRGB = false;
-		Tex->CompressionSettings = TC_Normalmap;
-		Tex->LODGroup = TEXTUREGROUP_WorldNormalMap;
-		break;
-	case EPBRTextureRole::Emissive:
-		Tex->SRGB = true;
-		Tex->CompressionSettings = TC_Default;
+		Settings.bSRGB = false;
+		Settings.Compression = TC_Normalmap;
+		Settings.LODGroup = TEXTUREGROUP_WorldNormalMap;
 		break;
 	}
+	return Settings;
+}
+
+// Roles that share sRGB / compression settings can share a texture (BaseColor and Emissive do).
+static int32 GetRoleSettingsClass(EPBRTextureRole Role)
+{
+	switch (Role)
+	{
+	case EPBRTextureRole::ORM:
+		return 1;
+	case EPBRTextureRole::Normal:
+		return 2;
+	default:
+		return 0;
+	}
+}
+
+static bool IsTextureCompatibleWithRole(const UTexture2D* Tex, EPBRTextureRole Role)
+{
 	// The master material (M_ORM) samples every map as a Virtual Texture
 	// (SAMPLERTYPE_Virtual*), so the imported textures must be VT-streaming or the
 	// sampler reports "requires virtual texture" and the binding is invalid.
+	const FPBRRoleSettings Settings = GetRoleSettings(Role);
+	return Tex->VirtualTextureStreaming && Tex->SRGB == Settings.bSRGB && Tex->CompressionSettings == Settings.Compression;
+}
+
+/**
+ * Sets the role's settings on a texture that did not get them at import time (e.g. Interchange is
+ * disabled for textures). Returns true when something changed; the caller rebuilds it with PostEditChange.
+ */
+static bool ApplyTextureRoleSettings(UTexture2D* Tex, EPBRTextureRole Role)
+{
+	const FPBRRoleSettings Settings = GetRoleSettings(Role);
+	const bool bLODGroupMatches = !Settings.LODGroup.IsSet() || Tex->LODGroup == Settings.LODGroup.GetValue();
+	if (IsTextureCompatibleWithRole(Tex, Role) && bLODGroupMatches)
+	{
+		return false;
+	}
+	Tex->PreEditChange(nullptr);
+	Tex->SRGB = Settings.bSRGB;
+	Tex->CompressionSettings = Settings.Compression;
+	if (Settings.LODGroup.IsSet())
+	{
+		Tex->LODGroup = Settings.LODGroup.GetValue();
+	}
 	Tex->VirtualTextureStreaming = true;
-	Tex->UpdateResource();
-	Tex->PostEditChange();
-	Tex->MarkPackageDirty();
+	return true;
+}
+
+/**
+ * Interchange pipeline stack that builds textures with the role's settings on their first build: the project's
+ * import stack for DiskFile, so project texture settings still apply, followed by the role pipeline.
+ */
+static UInterchangePipelineStackOverride* CreateRolePipelineStack(EPBRTextureRole Role, const FString& DiskFile)
+{
+	const FPBRRoleSettings Settings = GetRoleSettings(Role);
+	UBridgeTexturePipeline* RolePipeline = NewObject<UBridgeTexturePipeline>();
+	RolePipeline->bSRGB = Settings.bSRGB;
+	RolePipeline->CompressionSettings = Settings.Compression;
+	RolePipeline->bOverrideLODGroup = Settings.LODGroup.IsSet();
+	RolePipeline->LODGroup = Settings.LODGroup.Get(TEXTUREGROUP_World);
+	RolePipeline->bVirtualTextureStreaming = true;
+
+	UInterchangePipelineStackOverride* Stack = NewObject<UInterchangePipelineStackOverride>();
+	Stack->OverridePipelines = UAssetsBridgeTools::GetProjectImportPipelines(DiskFile);
+	if (Stack->OverridePipelines.Num() == 0)
+	{
+		Stack->AddPipeline(NewObject<UInterchangeGenericAssetsPipeline>());
+	}
+	Stack->AddPipeline(RolePipeline);
+	return Stack;
+}
+
+// Content addressed name of a shared texture: the PNG's MD5 plus the role settings it was built with.
+static FString GetSharedTextureName(const FString& Hash, EPBRTextureRole Role)
+{
+	static const TCHAR* Suffixes[] = {TEXT(""), TEXT("_ORM"), TEXT("_N")};
+	return FString::Printf(TEXT("T_%s%s"), *Hash, Suffixes[GetRoleSettingsClass(Role)]);
+}
+
+/**
+ * The shared texture at ObjectPath, when it exists and its import data records the PNG hash its name
+ * stands for. The hash is read from the asset registry tag first, so only a confirmed match is loaded.
+ * bOutConflict is set when the path holds other content (e.g. reimported by hand); it must not be overwritten.
+ */
+static UTexture2D* FindSharedTexture(IAssetRegistry& AssetRegistry, const FString& ObjectPath, const FString& Hash, bool& bOutConflict)
+{
+	bOutConflict = false;
+	const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+	if (!Asset.IsValid())
+	{
+		return nullptr;
+	}
+	FString ImportDataJson;
+	TOptional<FAssetImportInfo> ImportInfo;
+	if (Asset.GetTagValue(UAssetImportData::SourceFileTagName(), ImportDataJson))
+	{
+		ImportInfo = FAssetImportInfo::FromJson(ImportDataJson);
+	}
+	if (!ImportInfo.IsSet() || ImportInfo->SourceFiles.Num() != 1 || LexToString(ImportInfo->SourceFiles[0].FileHash) != Hash)
+	{
+		bOutConflict = true;
+		return nullptr;
+	}
+	UTexture2D* Tex = Cast<UTexture2D>(Asset.GetAsset());
+	bOutConflict = Tex == nullptr;
+	return Tex;
 }
 #endif
 
 UTexture2D* UPBRMaterialBuilder::ImportTexture(const FString& DiskFile, const FString& TargetContentFolder,
                                                EPBRTextureRole Role, FString& OutMessage)
 {
-#if WITH_EDITOR
-	if (DiskFile.IsEmpty() || !FPaths::FileExists(DiskFile))
+	TArray<FPBRTextureImport> Requests;
+	FPBRTextureImport& Request = Requests.AddDefaulted_GetRef();
+	Request.DiskFile = DiskFile;
+	Request.TargetContentFolder = TargetContentFolder;
+	Request.Role = Role;
+	ImportTextures(Requests, 1);
+	OutMessage = Requests[0].Message;
+	return Requests[0].Texture;
+}
+
+bool FPBRTextureImportBatch::IsImportComplete() const
+{
+	for (const UAssetImportTask* Task : Tasks)
 	{
-		OutMessage = FString::Printf(TEXT("Texture file missing: %s"), *DiskFile);
-		return nullptr;
+		if (Task->bAsync && !Task->IsAsyncImportComplete())
+		{
+			return false;
+		}
 	}
+	return true;
+}
 
-	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+void UPBRMaterialBuilder::ImportTextures(TArray<FPBRTextureImport>& Requests, int32 BatchSize)
+{
+	FPBRTextureImportBatch Batch;
+	SubmitTextureImports(Requests, BatchSize, false, Batch);
+	ResolveTextureImports(Requests, Batch);
+}
 
-	UAssetImportTask* Task = NewObject<UAssetImportTask>();
-	Task->Filename = DiskFile;
-	Task->DestinationPath = TargetContentFolder;
-	Task->DestinationName = FPaths::GetBaseFilename(DiskFile);
-	Task->bSave = false;
-	Task->bAutomated = true;
-	Task->bReplaceExisting = true;
-	Task->bReplaceExistingSettings = false;
+void UPBRMaterialBuilder::SubmitTextureImports(TArray<FPBRTextureImport>& Requests, int32 BatchSize, bool bAsync,
+                                               FPBRTextureImportBatch& OutBatch)
+{
+	BRIDGE_STAGE_SCOPE("Texture Import");
+#if WITH_EDITOR
+	const UABSettings* Settings = GetDefault<UABSettings>();
+	const bool bDeduplicate = Settings->bDeduplicateTextures && !Settings->SharedTextureFolder.IsEmpty();
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-	TArray<UAssetImportTask*> Tasks;
-	Tasks.Add(Task);
-	AssetToolsModule.Get().ImportAssetTasks(Tasks);
+	// One task per distinct content and role settings; every request points at the task that serves it
+	TArray<UAssetImportTask*>& Tasks = OutBatch.Tasks;
+	TArray<EPBRTextureRole>& TaskRoles = OutBatch.TaskRoles;
+	TArray<int32>& TaskOfRequest = OutBatch.TaskOfRequest;
+	TArray<int32> TaskFirstRequest;
+	TMap<FString, int32> TaskByKey;
+	TMap<int32, UInterchangePipelineStackOverride*> RoleStacks;
+	TMap<FString, FString> HashByFile;
+	// Shared textures that already exist, by object path, so each is looked up and loaded once
+	TMap<FString, UTexture2D*> ExistingShared;
+	TaskOfRequest.Init(INDEX_NONE, Requests.Num());
+	for (int32 Idx = 0; Idx < Requests.Num(); Idx++)
+	{
+		FPBRTextureImport& Request = Requests[Idx];
+		if (Request.DiskFile.IsEmpty() || !FPaths::FileExists(Request.DiskFile))
+		{
+			Request.Message = FString::Printf(TEXT("Texture file missing: %s"), *Request.DiskFile);
+			continue;
+		}
+		FString DestinationPath = Request.TargetContentFolder;
+		FString DestinationName = FPaths::GetBaseFilename(Request.DiskFile);
+		FString Key = DestinationPath / DestinationName + TEXT("|") + Request.DiskFile;
+		if (bDeduplicate)
+		{
+			FString* Hash = HashByFile.Find(Request.DiskFile);
+			if (!Hash)
+			{
+				Hash = &HashByFile.Add(Request.DiskFile, LexToString(FMD5Hash::HashFile(*Request.DiskFile)));
+			}
+			// Deduplicated textures live at a content addressed path no item owns, so reimporting one item's
+			// changed PNG creates a new texture instead of changing the materials of every item sharing it
+			const FString SharedName = GetSharedTextureName(*Hash, Request.Role);
+			const FString SharedPath = Settings->SharedTextureFolder / SharedName + TEXT(".") + SharedName;
+			UTexture2D** Shared = ExistingShared.Find(SharedPath);
+			bool bConflict = false;
+			if (!Shared && !TaskByKey.Contains(SharedPath))
+			{
+				UTexture2D* Found = FindSharedTexture(AssetRegistry, SharedPath, *Hash, bConflict);
+				// Its name already implies the role settings, this only repairs a texture edited by hand
+				if (Found && ApplyTextureRoleSettings(Found, Request.Role))
+				{
+					Found->PostEditChange();
+					Found->MarkPackageDirty();
+				}
+				Shared = Found ? &ExistingShared.Add(SharedPath, Found) : nullptr;
+			}
+			if (Shared)
+			{
+				Request.Texture = *Shared;
+				Request.bDeduplicated = true;
+				Request.BytesSaved = IFileManager::Get().FileSize(*Request.DiskFile);
+				Request.Message = FString::Printf(TEXT("Reused %s"), *Request.Texture->GetPathName());
+				continue;
+			}
+			if (bConflict)
+			{
+				UE_LOG(LogAssetsBridge, Warning, TEXT("%s does not hold the content of %s, importing it unshared"),
+				       *SharedPath, *Request.DiskFile);
+			}
+			else
+			{
+				DestinationPath = Settings->SharedTextureFolder;
+				DestinationName = SharedName;
+				Key = SharedPath;
+			}
+		}
+		if (const int32* Existing = TaskByKey.Find(Key))
+		{
+			// Same content as an earlier request for another file or folder becomes one shared asset
+			TaskOfRequest[Idx] = *Existing;
+			const FPBRTextureImport& First = Requests[TaskFirstRequest[*Existing]];
+			if (First.DiskFile != Request.DiskFile || First.TargetContentFolder != Request.TargetContentFolder)
+			{
+				Request.bDeduplicated = true;
+				Request.BytesSaved = IFileManager::Get().FileSize(*Request.DiskFile);
+			}
+			continue;
+		}
 
-	UTexture2D* Tex = nullptr;
-	for (UObject* Obj : Task->GetObjects())
+		UAssetImportTask* Task = NewObject<UAssetImportTask>();
+		Task->Filename = Request.DiskFile;
+		Task->DestinationPath = DestinationPath;
+		Task->DestinationName = DestinationName;
+		Task->bSave = false;
+		Task->bAutomated = true;
+		Task->bReplaceExisting = true;
+		Task->bReplaceExistingSettings = false;
+		Task->bAsync = bAsync;
+		// Textures get their role's settings on the first (async) build instead of being rebuilt afterwards
+		UInterchangePipelineStackOverride*& RoleStack = RoleStacks.FindOrAdd(GetRoleSettingsClass(Request.Role));
+		if (!RoleStack)
+		{
+			RoleStack = CreateRolePipelineStack(Request.Role, Request.DiskFile);
+		}
+		Task->Options = RoleStack;
+		TaskOfRequest[Idx] = Tasks.Add(Task);
+		TaskRoles.Add(Request.Role);
+		TaskFirstRequest.Add(Idx);
+		TaskByKey.Add(Key, TaskOfRequest[Idx]);
+	}
+	int32 NumDeduplicated = 0;
+	int64 BytesSaved = 0;
+	for (const FPBRTextureImport& Request : Requests)
 	{
-		Tex = Cast<UTexture2D>(Obj);
-		if (Tex)
+		NumDeduplicated += Request.bDeduplicated ? 1 : 0;
+		BytesSaved += Request.BytesSaved;
+	}
+	if (NumDeduplicated > 0)
+	{
+		UE_LOG(LogAssetsBridge, Log, TEXT("Textures: %d deduplicated (%.1f MB of PNG not imported), %d to import"),
+		       NumDeduplicated, BytesSaved / (1024.0 * 1024.0), Tasks.Num());
+	}
+	if (Tasks.Num() == 0)
+	{
+		return;
+	}
+
+	// The tasks and pipelines are only referenced from the batch, so keep them alive until it is resolved
+	for (UAssetImportTask* Task : Tasks)
+	{
+		OutBatch.Refs.Emplace(Task);
+	}
+	for (const TPair<int32, UInterchangePipelineStackOverride*>& RoleStack : RoleStacks)
+	{
+		OutBatch.Refs.Emplace(RoleStack.Value);
+		for (UObject* Pipeline : UAssetsBridgeTools::GetStackPipelines(RoleStack.Value))
 		{
-			break;
+			OutBatch.Refs.Emplace(Pipeline);
 		}
 	}
+	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+	const int32 ChunkSize = BatchSize > 0 ? BatchSize : Tasks.Num();
+	for (int32 Start = 0; Start < Tasks.Num(); Start += ChunkSize)
+	{
+		TArray<UAssetImportTask*> Chunk(Tasks.GetData() + Start, FMath::Min(ChunkSize, Tasks.Num() - Start));
+		AssetToolsModule.Get().ImportAssetTasks(Chunk);
+	}
+#else
+	for (FPBRTextureImport& Request : Requests)
+	{
+		Request.Message = TEXT("Texture import is editor-only.");
+	}
+#endif
+}
 
-	if (!Tex)
+void UPBRMaterialBuilder::ResolveTextureImports(TArray<FPBRTextureImport>& Requests, FPBRTextureImportBatch& Batch)
+{
+	BRIDGE_STAGE_SCOPE("Texture Import");
+#if WITH_EDITOR
+	const TArray<UAssetImportTask*>& Tasks = Batch.Tasks;
+	TArray<UTexture2D*> TaskTextures;
+	TaskTextures.Init(nullptr, Tasks.Num());
+	TArray<UTexture2D*> NeedsRebuild;
+	for (int32 TaskIdx = 0; TaskIdx < Tasks.Num(); TaskIdx++)
 	{
-		OutMessage = FString::Printf(TEXT("Import produced no texture for %s"), *DiskFile);
-		return nullptr;
+		for (UObject* Obj : Tasks[TaskIdx]->GetObjects())
+		{
+			TaskTextures[TaskIdx] = Cast<UTexture2D>(Obj);
+			if (TaskTextures[TaskIdx])
+			{
+				break;
+			}
+		}
+		// Only textures the pipeline could not configure (e.g. legacy factory import) need a second build
+		if (TaskTextures[TaskIdx] && ApplyTextureRoleSettings(TaskTextures[TaskIdx], Batch.TaskRoles[TaskIdx]))
+		{
+			NeedsRebuild.Add(TaskTextures[TaskIdx]);
+		}
+	}
+	if (NeedsRebuild.Num() > 0)
+	{
+		// PostEditChange queues the rebuild with the texture compiler, so these compile in parallel
+		// with each other and with the rest of the import rather than one at a time on this thread
+		for (UTexture2D* Tex : NeedsRebuild)
+		{
+			Tex->PostEditChange();
+			Tex->MarkPackageDirty();
+		}
+		UE_LOG(LogAssetsBridge, Log, TEXT("Textures: %d of %d imported texture(s) rebuilt to apply role settings"),
+		       NeedsRebuild.Num(), Tasks.Num());
 	}
 
-	ApplyTextureRoleSettings(Tex, Role);
-	OutMessage = FString::Printf(TEXT("Imported %s"), *Tex->GetPathName());
-	return Tex;
-#else
-	OutMessage = TEXT("Texture import is editor-only.");
-	return nullptr;
+	for (int32 Idx = 0; Idx < Requests.Num(); Idx++)
+	{
+		const int32 TaskIdx = Batch.TaskOfRequest.IsValidIndex(Idx) ? Batch.TaskOfRequest[Idx] : INDEX_NONE;
+		if (TaskIdx == INDEX_NONE)
+		{
+			continue;
+		}
+		FPBRTextureImport& Request = Requests[Idx];
+		Request.Texture = TaskTextures[TaskIdx];
+		if (!Request.Texture)
+		{
+			Request.Message = FString::Printf(TEXT("Import produced no texture for %s"), *Request.DiskFile);
+			continue;
+		}
+		Request.Message = FString::Printf(TEXT("Imported %s"), *Request.Texture->GetPathName());
+	}
+	Batch.Refs.Reset();
 #endif
 }
 
+int32 UPBRMaterialBuilder::AddTextureSetImports(const FBridgeTextureSet& Set, const FString& FallbackContentDir,
+                                                TArray<FPBRTextureImport>& Requests)
+{
+	const int32 FirstRequest = Requests.Num();
+	auto AddImport = [&Requests, &FallbackContentDir](const FBridgeTexture& Texture, EPBRTextureRole Role)
+	{
+		// Blank entries are skipped; null textures simply leave master defaults in place
+		if (Texture.File.IsEmpty())
+		{
+			return;
+		}
+		FPBRTextureImport& Request = Requests.AddDefaulted_GetRef();
+		Request.DiskFile = Texture.File;
+		// Prefer manifest content paths, else fallback
+		Request.TargetContentFolder = Texture.ContentPath.IsEmpty() ? FallbackContentDir : Texture.ContentPath;
+		Request.Role = Role;
+	};
+	AddImport(Set.BaseColor, EPBRTextureRole::BaseColor);
+	AddImport(Set.Orm, EPBRTextureRole::ORM);
+	AddImport(Set.Normal, EPBRTextureRole::Normal);
+	AddImport(Set.Emissive, EPBRTextureRole::Emissive);
+	return FirstRequest;
+}
+
+FPBRTextureSetTextures UPBRMaterialBuilder::ResolveTextureSet(const FBridgeTextureSet& Set, const TArray<FPBRTextureImport>& Requests,
+                                                              int32 FirstRequest)
+{
+	// Same order and skipping as AddTextureSetImports
+	FPBRTextureSetTextures Textures;
+	int32 Next = FirstRequest;
+	auto Take = [&Requests, &Next](const FBridgeTexture& Texture) -> UTexture2D*
+	{
+		if (Texture.File.IsEmpty() || !Requests.IsValidIndex(Next))
+		{
+			return nullptr;
+		}
+		return Requests[Next++].Texture;
+	};
+	Textures.BaseColor = Take(Set.BaseColor);
+	Textures.Orm = Take(Set.Orm);
+	Textures.Normal = Take(Set.Normal);
+	Textures.Emissive = Take(Set.Emissive);
+	return Textures;
+}
+
 UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBridgeTextureSet& Set,
                                                                       const FString& ShortName,
                                                                       const FString& FallbackContentDir,
                                                                       const FString& MasterPathOverride,
                                                                       FString& OutMessage)
 {
+	TArray<FPBRTextureImport> Requests;
+	const int32 FirstRequest = AddTextureSetImports(Set, FallbackContentDir, Requests);
+	ImportTextures(Requests, 0);
+	return BuildMaterialInstance(Set, ResolveTextureSet(Set, Requests, FirstRequest), ShortName, FallbackContentDir,
+	                             MasterPathOverride, OutMessage);
+}
+
+UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBridgeTextureSet& Set,
+                                                                      const FPBRTextureSetTextures& Textures,
+                                                                      const FString& ShortName,
+                                                                      const FString& FallbackContentDir,
+                                                                      const FString& MasterPathOverride,
+                                                                      FString& OutMessage)
+{
+	BRIDGE_STAGE_SCOPE("Material Instance");
 #if WITH_EDITOR
 	// Resolve the master material.
 	FString MasterPath = MasterPathOverride;
@@ -125,22 +490,10 @@ UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBri
 		return nullptr;
 	}
 
-	// Resolve content folder for textures + MI (prefer manifest content paths, else fallback).
-	auto FolderOf = [](const FString& ContentPath, const FString& Fallback) -> FString
-	{
-		return ContentPath.IsEmpty() ? Fallback : ContentPath;
-	};
-	const FString BaseFolder = FolderOf(Set.BaseColor.ContentPath, FallbackContentDir);
-	const FString OrmFolder = FolderOf(Set.Orm.ContentPath, FallbackContentDir);
-	const FString NormalFolder = FolderOf(Set.Normal.ContentPath, FallbackContentDir);
-	const FString EmissiveFolder = FolderOf(Set.Emissive.ContentPath, FallbackContentDir);
-
-	// Import textures (skip blanks; null textures simply leave master defaults in place).
-	FString Msg;
-	UTexture2D* BaseTex = Set.BaseColor.File.IsEmpty() ? nullptr : ImportTexture(Set.BaseColor.File, BaseFolder, EPBRTextureRole::BaseColor, Msg);
-	UTexture2D* OrmTex = Set.Orm.File.IsEmpty() ? nullptr : ImportTexture(Set.Orm.File, OrmFolder, EPBRTextureRole::ORM, Msg);
-	UTexture2D* NormalTex = Set.Normal.File.IsEmpty() ? nullptr : ImportTexture(Set.Normal.File, NormalFolder, EPBRTextureRole::Normal, Msg);
-	UTexture2D* EmissiveTex = Set.Emissive.File.IsEmpty() ? nullptr : ImportTexture(Set.Emissive.File, EmissiveFolder, EPBRTextureRole::Emissive, Msg);
+	UTexture2D* BaseTex = Textures.BaseColor;
+	UTexture2D* OrmTex = Textures.Orm;
+	UTexture2D* NormalTex = Textures.Normal;
+	UTexture2D* EmissiveTex = Textures.Emissive;
 
 	// Resolve the MI package path + name.
 	FString MIObjectPath = Set.MaterialInstance;
@@ -160,9 +513,14 @@ UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBri
 	// Load existing MI or create a new one parented to the master.
 	const FString MIFullPath = MIPackagePath / MIName + TEXT(".") + MIName;
 	UMaterialInstanceConstant* MIC = LoadObject<UMaterialInstanceConstant>(nullptr, *MIFullPath);
+	bool bChanged = false;
 	if (MIC)
 	{
-		MIC->SetParentEditorOnly(Master);
+		if (MIC->Parent != Master)
+		{
+			MIC->SetParentEditorOnly(Master);
+			bChanged = true;
+		}
 	}
 	else
 	{
@@ -172,6 +530,7 @@ UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBri
 		UObject* NewAsset = AssetToolsModule.Get().CreateAsset(MIName, MIPackagePath,
 			UMaterialInstanceConstant::StaticClass(), Factory);
 		MIC = Cast<UMaterialInstanceConstant>(NewAsset);
+		bChanged = true;
 	}
 
 	if (!MIC)
@@ -182,11 +541,16 @@ UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBri
 
 	// Wire texture parameters (only those that imported; nulls keep master defaults).
 	// Use the engine-level editor-only setter (no MaterialEditor module dependency).
-	auto SetTex = [MIC](const TCHAR* Param, UTexture2D* Tex)
+	// Every setter compares against the current value first so a reimport that changes nothing
+	// does not dirty the package or recompile the instance.
+	auto SetTex = [MIC, &bChanged](const TCHAR* Param, UTexture2D* Tex)
 	{
-		if (Tex)
+		const FMaterialParameterInfo Info{FName(Param)};
+		UTexture* Current = nullptr;
+		if (Tex && !(MIC->GetTextureParameterValue(Info, Current) && Current == Tex))
 		{
-			MIC->SetTextureParameterValueEditorOnly(FMaterialParameterInfo(FName(Param)), Tex);
+			MIC->SetTextureParameterValueEditorOnly(Info, Tex);
+			bChanged = true;
 		}
 	};
 	SetTex(TEXT("BaseColor"), BaseTex);
@@ -199,10 +563,29 @@ UMaterialInstanceConstant* UPBRMaterialBuilder::BuildMaterialInstance(const FBri
 	// tune 'Emissive Intensity' afterwards; re-imports preserve nothing here, so we re-apply.
 	if (EmissiveTex)
 	{
-		MIC->SetStaticSwitchParameterValueEditorOnly(FMaterialParameterInfo(FName("Use Emissive Mask")), true);
-		MIC->SetScalarParameterValueEditorOnly(FMaterialParameterInfo(FName("Emissive Intensity")), 2.0f);
+		// A static switch change means a new shader permutation, so it is the one to avoid most
+		const FMaterialParameterInfo SwitchInfo{FName("Use Emissive Mask")};
+		bool bSwitchValue = false;
+		FGuid SwitchGuid;
+		if (!(MIC->GetStaticSwitchParameterValue(SwitchInfo, bSwitchValue, SwitchGuid) && bSwitchValue))
+		{
+			MIC->SetStaticSwitchParameterValueEditorOnly(SwitchInfo, true);
+			bChanged = true;
+		}
+		const FMaterialParameterInfo IntensityInfo{FName("Emissive Intensity")};
+		float Intensity = 0.0f;
+		if (!(MIC->GetScalarParameterValue(IntensityInfo, Intensity) && Intensity == 2.0f))
+		{
+			MIC->SetScalarParameterValueEditorOnly(IntensityInfo, 2.0f);
+			bChanged = true;
+		}
 	}
 
+	if (!bChanged)
+	{
+		OutMessage = FString::Printf(TEXT("Material instance %s is up to date (parent %s)"), *MIC->GetPathName(), *MasterPath);
+		return MIC;
+	}
 	MIC->PostEditChange();
 	MIC->MarkPackageDirty();
 
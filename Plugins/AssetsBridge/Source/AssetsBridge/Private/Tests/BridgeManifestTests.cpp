@@ -0,0 +1,211 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "AssetsBridgeTools.h"
+#include "BridgeManifest.h"
+#include "JsonObjectConverter.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** A manifest with every field set, including strings that only differ in case and non-ASCII ones. */
+static FBridgeExport MakeTestManifest(int32 NumItems)
+{
+	FBridgeExport Manifest;
+	Manifest.Operation = TEXT("BlenderExport");
+	for (int32 Idx = 0; Idx < NumItems; Idx++)
+	{
+		FExportAsset& Item = Manifest.Objects.AddDefaulted_GetRef();
+		const FString Name = FString::Printf(TEXT("SK_Part_%d"), Idx);
+		Item.Model = FString::Printf(TEXT("/Game/Characters/%s.%s"), *Name, *Name);
+		Item.ObjectID = FString::Printf(TEXT("object-%d"), Idx);
+		Item.InternalPath = TEXT("/Characters");
+		Item.RelativeExportPath = TEXT("/Characters");
+		Item.ShortName = Name;
+		Item.ExportLocation = FString::Printf(TEXT("/tmp/bridge/Characters/%s.glb"), *Name);
+		Item.StringType = Idx % 2 ? TEXT("SkeletalMesh") : TEXT("StaticMesh");
+		Item.Skeleton = Idx % 2 ? TEXT("/Game/Characters/SK_Body_Skeleton.SK_Body_Skeleton") : FString();
+		Item.MorphTargets = {TEXT("Smile"), TEXT("smile"), TEXT("Brauen hoch \u00FC")};
+		Item.KeepEmptyMorphTargets = {TEXT("smile")};
+		for (int32 Slot = 0; Slot < 3; Slot++)
+		{
+			FMaterialSlot MaterialSlot;
+			MaterialSlot.Name = FString::Printf(TEXT("Slot%d"), Slot);
+			MaterialSlot.Idx = Slot;
+			MaterialSlot.InternalPath = TEXT("/Game/Materials/M_Skin.M_Skin");
+			MaterialSlot.OriginalIdx = Slot - 1;
+			Item.ObjectMaterials.Add(MaterialSlot);
+			(Slot == 0 ? Item.MaterialChangeset.Unchanged : (Slot == 1 ? Item.MaterialChangeset.Added : Item.MaterialChangeset.Removed)).Add(MaterialSlot);
+		}
+		// Exactly representable, so the JSON text round-trips them bit for bit
+		Item.WorldData.Rotation = FVector(0.0, -90.0, 180.5);
+		Item.WorldData.Location = FVector(Idx * 100.25, -12.5, 0.125);
+		Item.WorldData.Scale = FVector(1.0, 1.0, 2.0);
+		Item.Textures.BaseColor.File = TEXT("/tmp/bridge/Textures/base.png");
+		Item.Textures.BaseColor.ContentPath = TEXT("/Game/Characters/Textures");
+		Item.Textures.Orm.File = TEXT("/tmp/bridge/Textures/orm.png");
+		Item.Textures.Orm.ContentPath = TEXT("/Game/Characters/Textures");
+		Item.Textures.Normal.File = TEXT("/tmp/bridge/Textures/normal.png");
+		Item.Textures.Normal.ContentPath = TEXT("/Game/Characters/Textures");
+		Item.Textures.Master = TEXT("/Game/Materials/_Core/M_ORM");
+		Item.Textures.MaterialInstance = FString::Printf(TEXT("/Game/Characters/MI_%s"), *Name);
+	}
+	return Manifest;
+}
+
+/** Compares two manifests through their reflected properties and names the first item that differs. */
+static bool TestManifestsEqual(FAutomationTestBase& Test, const FString& What, const FBridgeExport& Actual, const FBridgeExport& Expected)
+{
+	if (FBridgeExport::StaticStruct()->CompareScriptStruct(&Actual, &Expected, PPF_None))
+	{
+		return true;
+	}
+	if (Actual.Operation != Expected.Operation || Actual.Objects.Num() != Expected.Objects.Num())
+	{
+		Test.AddError(FString::Printf(TEXT("%s: operation '%s' with %d item(s), expected '%s' with %d"), *What, *Actual.Operation,
+		                              Actual.Objects.Num(), *Expected.Operation, Expected.Objects.Num()));
+		return false;
+	}
+	for (int32 Idx = 0; Idx < Expected.Objects.Num(); Idx++)
+	{
+		if (!FExportAsset::StaticStruct()->CompareScriptStruct(&Actual.Objects[Idx], &Expected.Objects[Idx], PPF_None))
+		{
+			FString ActualJson;
+			FString ExpectedJson;
+			FJsonObjectConverter::UStructToJsonObjectString(Actual.Objects[Idx], ActualJson);
+			FJsonObjectConverter::UStructToJsonObjectString(Expected.Objects[Idx], ExpectedJson);
+			Test.AddError(FString::Printf(TEXT("%s: item %d differs\n%s\nexpected\n%s"), *What, Idx, *ActualJson, *ExpectedJson));
+			return false;
+		}
+	}
+	Test.AddError(FString::Printf(TEXT("%s: manifests differ"), *What));
+	return false;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FBridgeManifestRoundTripTest, "AssetsBridge.Manifest.RoundTrip",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FBridgeManifestRoundTripTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("Empty"));
+	OutTestCommands.Add(TEXT("0"));
+	OutBeautifiedNames.Add(TEXT("Single Item"));
+	OutTestCommands.Add(TEXT("1"));
+	OutBeautifiedNames.Add(TEXT("Many Items"));
+	OutTestCommands.Add(TEXT("250"));
+}
+
+bool FBridgeManifestRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FBridgeExport Manifest = MakeTestManifest(FCString::Atoi(*Parameters));
+	bool bIsSuccessful = false;
+	FString OutMessage;
+
+	// JSON as the addon and WriteBridgeExportFileAt write it, read back by the streaming reader
+	FString Json;
+	FJsonObjectConverter::UStructToJsonObjectString(Manifest, Json);
+	const FTCHARToUTF8 Utf8(*Json);
+	FBridgeExport FromJson;
+	UBridgeManifest::ParseJson(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), FromJson, bIsSuccessful, OutMessage);
+	TestTrue(FString::Printf(TEXT("ParseJson: %s"), *OutMessage), bIsSuccessful);
+	TestManifestsEqual(*this, TEXT("JSON"), FromJson, Manifest);
+
+	TArray<uint8> Binary;
+	UBridgeManifest::WriteBinary(Manifest, Binary);
+	TestTrue(TEXT("Binary manifest starts with the magic"), UBridgeManifest::IsBinary(Binary));
+	FBridgeExport FromBinary;
+	UBridgeManifest::ParseBinary(Binary, FromBinary, bIsSuccessful, OutMessage);
+	TestTrue(FString::Printf(TEXT("ParseBinary: %s"), *OutMessage), bIsSuccessful);
+	TestManifestsEqual(*this, TEXT("Binary"), FromBinary, Manifest);
+
+	// JSON -> binary, the conversion a format switch performs
+	TArray<uint8> Converted;
+	UBridgeManifest::WriteBinary(FromJson, Converted);
+	TestTrue(TEXT("JSON and original manifest encode to the same binary"), Converted == Binary);
+
+	// A truncated file must be rejected rather than half read
+	FBridgeExport Truncated;
+	UBridgeManifest::ParseBinary(TConstArrayView<uint8>(Binary.GetData(), Binary.Num() - 1), Truncated, bIsSuccessful, OutMessage);
+	TestFalse(TEXT("Truncated binary manifest is rejected"), bIsSuccessful);
+	return true;
+}
+
+/**
+ * A manifest the way the Blender addon writes it: keys in its own casing, a partial vector, integers written as
+ * floats, keys this version does not know and items that leave most fields out.
+ */
+static const TCHAR* AddonManifestJson = TEXT(R"json({
+	"operation": "BlenderExport",
+	"addonVersion": "2.4.0",
+	"objects": [
+		{
+			"model": "/Game/Props/SM_Crate.SM_Crate",
+			"objectId": "crate-1",
+			"objectMaterials": [{"name": "Wood", "idx": 0, "internalPath": "/Game/Props/M_Wood.M_Wood", "originalIdx": 0}],
+			"materialChangeset": {
+				"added": [{"name": "Metal", "idx": 1.0, "internalPath": "", "originalIdx": -1}],
+				"removed": [],
+				"unchanged": [{"name": "Wood", "idx": 0, "internalPath": "/Game/Props/M_Wood.M_Wood", "originalIdx": 0}]
+			},
+			"internalPath": "/Props",
+			"relativeExportPath": "/Props",
+			"shortName": "SM_Crate",
+			"exportLocation": "C:/Bridge/Props/SM_Crate.glb",
+			"stringType": "StaticMesh",
+			"skeleton": "",
+			"morphTargets": [],
+			"worldData": {"rotation": {"x": 0, "y": 0, "z": 90}, "location": {"x": 150.5, "y": -20, "z": 0}, "scale": {"z": 2}},
+			"textures": {
+				"baseColor": {"file": "C:/Bridge/Props/Textures/crate_base.png", "contentPath": "/Game/Props/Textures", "resolution": 2048},
+				"orm": {"file": "C:/Bridge/Props/Textures/crate_orm.png", "contentPath": "/Game/Props/Textures"},
+				"master": "/Game/Materials/_Core/M_ORM",
+				"materialInstance": "/Game/Props/MI_Crate"
+			},
+			"blenderObject": {"name": "Crate", "users": 2}
+		},
+		{
+			"model": "/Game/Characters/SK_Hero.SK_Hero",
+			"objectId": "hero-1",
+			"stringType": "SkeletalMesh",
+			"skeleton": "/Game/Characters/SK_Hero_Skeleton.SK_Hero_Skeleton",
+			"morphTargets": ["Smile", "Blink_L", "Corrective_Elbow"],
+			"keepEmptyMorphTargets": ["Corrective_Elbow"]
+		}
+	]
+})json");
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FBridgeManifestParseEquivalenceTest, "AssetsBridge.Manifest.ParseEquivalence",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FBridgeManifestParseEquivalenceTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("Addon Manifest"));
+	OutTestCommands.Add(TEXT("Addon"));
+	OutBeautifiedNames.Add(TEXT("Written Manifest"));
+	OutTestCommands.Add(TEXT("Written"));
+}
+
+bool FBridgeManifestParseEquivalenceTest::RunTest(const FString& Parameters)
+{
+	FString Json = AddonManifestJson;
+	if (Parameters == TEXT("Written"))
+	{
+		FJsonObjectConverter::UStructToJsonObjectString(MakeTestManifest(50), Json);
+	}
+
+	// The DOM reader ReadBridgeExportFile used before the streaming reader, the reference for every field
+	FBridgeExport FromConverter;
+	TestTrue(TEXT("FJsonObjectConverter parses the manifest"), FJsonObjectConverter::JsonObjectStringToUStruct(Json, &FromConverter));
+
+	bool bIsSuccessful = false;
+	FString OutMessage;
+	const FTCHARToUTF8 Utf8(*Json);
+	FBridgeExport FromStreaming;
+	UBridgeManifest::ParseJson(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), FromStreaming, bIsSuccessful, OutMessage);
+	TestTrue(FString::Printf(TEXT("ParseJson: %s"), *OutMessage), bIsSuccessful);
+
+	// Compared through reflection, so a field MakeTestManifest sets that ParseJson does not read fails here
+	TestManifestsEqual(*this, TEXT("ParseJson against FJsonObjectConverter"), FromStreaming, FromConverter);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,91 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeManager.h"
+#include "Animation/MorphTarget.h"
+#include "Engine/SkeletalMesh.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Transient mesh with morph targets of the given names, in that order, as the importer would create them. */
+static USkeletalMesh* MakeMorphMesh(const TArray<FString>& ImportedNames)
+{
+	USkeletalMesh* Mesh = NewObject<USkeletalMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	for (const FString& Name : ImportedNames)
+	{
+		Mesh->GetMorphTargets().Add(NewObject<UMorphTarget>(Mesh, FName(*Name), RF_Transient));
+	}
+	return Mesh;
+}
+
+/** Checks the renames hold exactly the expected imported -> manifest pairs, names compared case-sensitively. */
+static void TestRenames(FAutomationTestBase& Test, const TMap<FName, FName>& Actual, const TMap<FString, FString>& Expected)
+{
+	Test.TestEqual(TEXT("Number of renames"), Actual.Num(), Expected.Num());
+	for (const TPair<FString, FString>& Pair : Expected)
+	{
+		const FName* Name = Actual.Find(FName(*Pair.Key));
+		if (!Name)
+		{
+			Test.AddError(FString::Printf(TEXT("No rename for %s"), *Pair.Key));
+		}
+		else if (Name->ToString() != Pair.Value)
+		{
+			Test.AddError(FString::Printf(TEXT("%s renamed to %s, expected %s"), *Pair.Key, *Name->ToString(), *Pair.Value));
+		}
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FBridgeMorphTargetRenamesTest, "AssetsBridge.MorphTargets.BuildRenames",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FBridgeMorphTargetRenamesTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("Keyed"));
+	OutTestCommands.Add(TEXT("Keyed"));
+	OutBeautifiedNames.Add(TEXT("Sanitized"));
+	OutTestCommands.Add(TEXT("Sanitized"));
+	OutBeautifiedNames.Add(TEXT("Unnamed Targets"));
+	OutTestCommands.Add(TEXT("Unnamed"));
+	OutBeautifiedNames.Add(TEXT("Collision"));
+	OutTestCommands.Add(TEXT("Collision"));
+}
+
+bool FBridgeMorphTargetRenamesTest::RunTest(const FString& Parameters)
+{
+	if (Parameters == TEXT("Keyed"))
+	{
+		// Matched by name whatever the order; a target the manifest does not list is left alone, not matched by position
+		const USkeletalMesh* Mesh = MakeMorphMesh({TEXT("Smile"), TEXT("Extra"), TEXT("Blink")});
+		const TArray<FString> Names = {TEXT("Blink"), TEXT("Frown"), TEXT("Smile")};
+		TestRenames(*this, UBridgeManager::BuildMorphTargetRenames(Mesh, Names, {TEXT("Smile"), TEXT("Extra"), TEXT("Blink")}),
+		            {{TEXT("Smile"), TEXT("Smile")}, {TEXT("Blink"), TEXT("Blink")}});
+	}
+	else if (Parameters == TEXT("Sanitized"))
+	{
+		// The importer turns shape key names into object names, the renames restore the originals
+		const TArray<FString> Names = {TEXT("Mouth.Open"), TEXT("Brow Up")};
+		const USkeletalMesh* Mesh = MakeMorphMesh({TEXT("Brow_Up"), TEXT("Mouth_Open")});
+		TestRenames(*this, UBridgeManager::BuildMorphTargetRenames(Mesh, Names, Names),
+		            {{TEXT("Mouth_Open"), TEXT("Mouth.Open")}, {TEXT("Brow_Up"), TEXT("Brow Up")}});
+	}
+	else if (Parameters == TEXT("Unnamed"))
+	{
+		// Without glTF target names only the manifest order is left to go by
+		const USkeletalMesh* Mesh = MakeMorphMesh({TEXT("MorphTarget_0"), TEXT("MorphTarget_1")});
+		TestRenames(*this, UBridgeManager::BuildMorphTargetRenames(Mesh, {TEXT("Smile"), TEXT("Blink")}, {}),
+		            {{TEXT("MorphTarget_0"), TEXT("Smile")}, {TEXT("MorphTarget_1"), TEXT("Blink")}});
+	}
+	else
+	{
+		// Names equal up to case or sanitizing cannot both exist on the mesh: the first one is restored, with a warning
+		AddExpectedMessage(TEXT("collide as"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 2, false);
+		const TArray<FString> Names = {TEXT("Smile"), TEXT("smile"), TEXT("Mouth.Open"), TEXT("Mouth_Open")};
+		const USkeletalMesh* Mesh = MakeMorphMesh({TEXT("Smile"), TEXT("Mouth_Open")});
+		TestRenames(*this, UBridgeManager::BuildMorphTargetRenames(Mesh, Names, {TEXT("Smile"), TEXT("Mouth.Open")}),
+		            {{TEXT("Smile"), TEXT("Smile")}, {TEXT("Mouth_Open"), TEXT("Mouth.Open")}});
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
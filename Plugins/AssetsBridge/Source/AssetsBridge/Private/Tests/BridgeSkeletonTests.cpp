@@ -0,0 +1,134 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#include "BridgeManager.h"
+#include "BridgeSkeletonIndex.h"
+#include "Misc/AutomationTest.h"
+#include "ReferenceSkeleton.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Parses "bone>parent" pairs separated by ';', an empty parent being a root. */
+static TArray<FBridgeBoneLink> MakeBones(const FString& Hierarchy)
+{
+	TArray<FString> Links;
+	Hierarchy.ParseIntoArray(Links, TEXT(";"));
+	TArray<FBridgeBoneLink> Bones;
+	for (const FString& Link : Links)
+	{
+		FString Bone;
+		FString Parent;
+		Link.Split(TEXT(">"), &Bone, &Parent);
+		Bones.Add({FName(*Bone), Parent.IsEmpty() ? NAME_None : FName(*Parent)});
+	}
+	return Bones;
+}
+
+/** Reference skeleton of the bones, which must list parents before their children. */
+static FReferenceSkeleton MakeRefSkeleton(const FString& Hierarchy)
+{
+	FReferenceSkeleton RefSkeleton;
+	{
+		FReferenceSkeletonModifier Modifier(RefSkeleton, nullptr);
+		for (const FBridgeBoneLink& Link : MakeBones(Hierarchy))
+		{
+			const int32 ParentIdx = Link.Parent.IsNone() ? INDEX_NONE : Modifier.FindBoneIndex(Link.Parent);
+			Modifier.Add(FMeshBoneInfo(Link.Bone, Link.Bone.ToString(), ParentIdx), FTransform::Identity);
+		}
+	}
+	return RefSkeleton;
+}
+
+static const TCHAR* FullBody = TEXT("root>;pelvis>root;spine>pelvis;head>spine;thigh_l>pelvis;thigh_r>pelvis");
+static const TCHAR* Torso = TEXT("root>;pelvis>root;spine>pelvis");
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FBridgeSkeletonIndexFindCompatibleTest, "AssetsBridge.Skeleton.FindCompatible",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FBridgeSkeletonIndexFindCompatibleTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("Exact"));
+	OutTestCommands.Add(TEXT("Exact"));
+	OutBeautifiedNames.Add(TEXT("Subset"));
+	OutTestCommands.Add(TEXT("Subset"));
+	OutBeautifiedNames.Add(TEXT("Incompatible"));
+	OutTestCommands.Add(TEXT("Incompatible"));
+}
+
+bool FBridgeSkeletonIndexFindCompatibleTest::RunTest(const FString& Parameters)
+{
+	const FSoftObjectPath FullBodyPath(TEXT("/Game/Tests/SK_FullBody.SK_FullBody"));
+	const FSoftObjectPath TorsoPath(TEXT("/Game/Tests/SK_Torso.SK_Torso"));
+	FBridgeSkeletonIndex Index;
+	Index.Add(FullBodyPath, MakeBones(FullBody));
+	Index.Add(TorsoPath, MakeBones(Torso));
+
+	if (Parameters == TEXT("Exact"))
+	{
+		// Order and case of the bones do not matter for an exact match
+		TestEqual(TEXT("Same hierarchy"), Index.FindCompatible(MakeBones(FullBody)).ToString(), FullBodyPath.ToString());
+		TestEqual(TEXT("Reordered, other case"), Index.FindCompatible(MakeBones(TEXT("Spine>Pelvis;Pelvis>Root;Root>"))).ToString(), TorsoPath.ToString());
+	}
+	else if (Parameters == TEXT("Subset"))
+	{
+		TestEqual(TEXT("Only the full body has the legs"), Index.FindCompatible(MakeBones(TEXT("root>;pelvis>root;thigh_l>pelvis"))).ToString(),
+		          FullBodyPath.ToString());
+		TestEqual(TEXT("Smallest containing skeleton wins"), Index.FindCompatible(MakeBones(TEXT("root>;pelvis>root"))).ToString(), TorsoPath.ToString());
+		TestEqual(TEXT("Roots may sit anywhere"), Index.FindCompatible(MakeBones(TEXT("spine>;head>spine"))).ToString(), FullBodyPath.ToString());
+	}
+	else
+	{
+		TestFalse(TEXT("Bone under another parent"), Index.FindCompatible(MakeBones(TEXT("root>;pelvis>root;head>pelvis"))).IsValid());
+		TestFalse(TEXT("Unknown bone"), Index.FindCompatible(MakeBones(TEXT("root>;tail>root"))).IsValid());
+		TestFalse(TEXT("No bones"), Index.FindCompatible(TArray<FBridgeBoneLink>()).IsValid());
+	}
+	return true;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FBridgeHierarchyCompatibleTest, "AssetsBridge.Skeleton.IsHierarchyCompatible",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FBridgeHierarchyCompatibleTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("Same"));
+	OutTestCommands.Add(TEXT("Same"));
+	OutBeautifiedNames.Add(TEXT("Subset"));
+	OutTestCommands.Add(TEXT("Subset"));
+	OutBeautifiedNames.Add(TEXT("Missing Bone"));
+	OutTestCommands.Add(TEXT("MissingBone"));
+	OutBeautifiedNames.Add(TEXT("Reparented"));
+	OutTestCommands.Add(TEXT("Reparented"));
+}
+
+bool FBridgeHierarchyCompatibleTest::RunTest(const FString& Parameters)
+{
+	const FReferenceSkeleton Target = MakeRefSkeleton(FullBody);
+	bool bBonesFound = false;
+	if (Parameters == TEXT("Same"))
+	{
+		TestTrue(TEXT("Same hierarchy is compatible"), UBridgeManager::IsHierarchyCompatible(MakeRefSkeleton(FullBody), Target, bBonesFound));
+		TestTrue(TEXT("Every bone found"), bBonesFound);
+	}
+	else if (Parameters == TEXT("Subset"))
+	{
+		// Bone indices differ from the target's, only names and parents are compared
+		const FReferenceSkeleton Legs = MakeRefSkeleton(TEXT("root>;pelvis>root;thigh_r>pelvis;thigh_l>pelvis"));
+		TestTrue(TEXT("Subset is compatible"), UBridgeManager::IsHierarchyCompatible(Legs, Target, bBonesFound));
+		TestTrue(TEXT("Every bone found"), bBonesFound);
+	}
+	else if (Parameters == TEXT("MissingBone"))
+	{
+		AddExpectedMessage(TEXT("Bone 'tail' not found in target skeleton"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1, false);
+		const FReferenceSkeleton Tailed = MakeRefSkeleton(TEXT("root>;pelvis>root;tail>pelvis"));
+		TestFalse(TEXT("Missing bone is incompatible"), UBridgeManager::IsHierarchyCompatible(Tailed, Target, bBonesFound));
+		TestFalse(TEXT("Missing bone reported"), bBonesFound);
+	}
+	else
+	{
+		const FReferenceSkeleton Reparented = MakeRefSkeleton(TEXT("root>;pelvis>root;head>pelvis"));
+		TestFalse(TEXT("Other parent is incompatible"), UBridgeManager::IsHierarchyCompatible(Reparented, Target, bBonesFound));
+		TestTrue(TEXT("Every bone found"), bBonesFound);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,6 +6,16 @@
 #include "UObject/NoExportTypes.h"
 #include "ABSettings.generated.h"
 
+/** On-disk encoding of the from-unreal / from-blender manifests. */
+UENUM()
+enum class EBridgeManifestFormat : uint8
+{
+	/** Pretty-printed JSON, readable and easy to debug */
+	Json,
+	/** Versioned binary layout with a deduplicated string table, for large scene syncs */
+	Binary
+};
+
 /**
  * 
  */
@@ -20,4 +30,56 @@ public:
 	/** Root directory on disk where assets are exported to/imported from */
 	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Configuration")
 	FString AssetLocationOnDisk;
+
+	/** Format used when writing the from-unreal manifest; Binary writes from-unreal.abmf instead of from-unreal.json. Either format is detected automatically when reading. */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Configuration")
+	EBridgeManifestFormat ManifestFormat;
+
+	/** Log extra diagnostics, such as every exporter class found, during bridge operations */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Configuration")
+	bool bVerboseLogging;
+
+	/** Number of headless editor processes that export meshes in parallel (0 = export everything in this editor). Assets with unsaved changes are always exported here. */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Export", meta = (ClampMin = "0", ClampMax = "32"))
+	int32 ParallelExportWorkers;
+
+	/** Reuse the .glb from the previous export when the asset, its materials, their textures, its skeleton and the glTF export options are unchanged and the file was not touched */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Export")
+	bool bSkipUnchangedExports;
+
+	/** Submit the import tasks of a sync together instead of one Interchange round trip per asset */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import")
+	bool bBatchImport;
+
+	/** Maximum number of import tasks handed to a single ImportAssetTasks call when batching (0 = no limit) */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import", meta = (ClampMin = "0", EditCondition = "bBatchImport"))
+	int32 ImportBatchSize;
+
+	/** Import without blocking the editor: tasks run asynchronously and post-import steps run as each one completes */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import")
+	bool bAsyncImport;
+
+	/** Skip importing items whose source .glb (and baked textures) are unchanged since they were last imported */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import")
+	bool bSkipUnchangedImports;
+
+	/** Import baked textures once per distinct PNG content and role into SharedTextureFolder, and reuse them from there instead of importing a copy per item */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import")
+	bool bDeduplicateTextures;
+
+	/** Content folder of the deduplicated textures, named T_<MD5 of the PNG> plus a role suffix. A texture there is never overwritten with other content */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import", meta = (ContentDir, EditCondition = "bDeduplicateTextures"))
+	FString SharedTextureFolder;
+
+	/** Retarget a skeletal mesh by reassigning its skeleton when the target already contains its bone hierarchy, instead of merging bones and rebuilding every LOD */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import")
+	bool bFastSkeletonRetarget;
+
+	/** On import, before the mesh is first built, drop morph targets with no meaningful deltas and strip negligible vertex deltas from the rest. Morph targets the manifest lists in keepEmptyMorphTargets are always kept */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import")
+	bool bPruneMorphTargets;
+
+	/** Vertex position deltas shorter than this (in cm) count as negligible when pruning morph targets */
+	UPROPERTY(Config, EditAnywhere, Category = "Assets Bridge Import", meta = (ClampMin = "0.0", Units = "cm", EditCondition = "bPruneMorphTargets"))
+	float MorphTargetPruneThreshold;
 };
@@ -6,6 +6,8 @@
 #include "Modules/ModuleManager.h"
 #include "AssetsBridge.generated.h"
 
+ASSETSBRIDGE_API DECLARE_LOG_CATEGORY_EXTERN(LogAssetsBridge, Log, All);
+
 class FToolBarBuilder;
 class FMenuBuilder;
 class AStaticMeshActor;
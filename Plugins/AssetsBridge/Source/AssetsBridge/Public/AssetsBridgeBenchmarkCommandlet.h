@@ -0,0 +1,107 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BridgeStats.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetsBridgeBenchmarkCommandlet.generated.h"
+
+/** One timed run of a benchmark case */
+USTRUCT(BlueprintType)
+struct FBridgeBenchmarkSample
+{
+	GENERATED_BODY()
+
+	/** Benchmark case, e.g. "Import" or "Manifest Parse (Binary)" */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString Case;
+
+	/** Zero-based iteration of the case */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	int32 Iteration = 0;
+
+	/** Number of manifest items the case worked on */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	int32 Items = 0;
+
+	/** Whether the bridge reported success for the run */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	bool bIsSuccessful = false;
+
+	/** Wall time of the run */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	double Seconds = 0.0;
+
+	/** Physical memory used by the process once the run finished */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	double UsedPhysicalMB = 0.0;
+
+	/** Peak physical memory of the process so far; it only grows, so cases are best compared in the same order */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	double PeakUsedPhysicalMB = 0.0;
+
+	/** Pipeline stage timings of the run */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	TArray<FBridgeStageStats> Stages;
+};
+
+/** Everything one benchmark run produced, written as the JSON report */
+USTRUCT(BlueprintType)
+struct FBridgeBenchmarkReport
+{
+	GENERATED_BODY()
+
+	/** Plugin version under test, so reports can be compared across releases */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString PluginVersion;
+
+	/** Platform the benchmark ran on */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString Platform;
+
+	/** UTC time the benchmark started (ISO 8601) */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString Timestamp;
+
+	/** Fixture manifest the cases ran on */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString Fixture;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	TArray<FBridgeBenchmarkSample> Samples;
+};
+
+/**
+ * Headless throughput benchmark of the bridge pipeline.
+ *
+ * Usage: UnrealEditor-Cmd <Project>.uproject -run=AssetsBridgeBenchmark -Fixture=<from-blender.json>
+ *        [-Cases=Manifest,Import,Retarget,RetargetFull,Export,Material] [-Iterations=<n>] [-ManifestItems=<n>]
+ *        [-LODs=<n>] [-Report=<file>] -unattended -nullrhi
+ *
+ * Runs every selected case Iterations times (default 3) over the fixture manifest:
+ *   Manifest - parses a manifest of ManifestItems entries (default 10000, fixture items repeated) through the
+ *              json object reader, the streaming reader and the binary reader, and writes it in both formats.
+ *   Import   - forced GenerateImport of the fixture.
+ *   Retarget - one RetargetSkeletalMeshesToSkeleton batch that binds every skeletal fixture item naming a skeleton
+ *              to it, each imported beforehand (untimed) without a skeleton so Interchange generates one and
+ *              then reduced to LODs levels of detail (default 1), since the glTF fixtures have a single LOD.
+ *   RetargetFull - the same with bFastSkeletonRetarget off, i.e. always merging bones and rebuilding the mesh.
+ *   Export   - GenerateExport of the imported meshes with the export cache disabled.
+ *   Material - BuildMaterialInstance for every fixture item with baked textures.
+ *
+ * Wall time, process memory and per-stage timings of each run are written to <file>.json and <file>.csv
+ * (default Saved/AssetsBridge/Benchmarks/benchmark-<time>). Nothing is saved to the project, but imported
+ * assets land where the fixture manifest points, so run it on a scratch project.
+ * Returns 0 when every run succeeded.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UAssetsBridgeBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAssetsBridgeBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,28 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetsBridgeCorpusCommandlet.generated.h"
+
+/**
+ * Generates a synthetic corpus for the benchmark and soak tests, see UBridgeCorpusGenerator.
+ *
+ * Usage: UnrealEditor-Cmd <Project>.uproject -run=AssetsBridgeCorpus -Output=<dir> [-Seed=<n>]
+ *        [-StaticMeshes=<n>] [-SkeletalMeshes=<n>] [-Triangles=<n>] [-Bones=<n>] [-Morphs=<n>]
+ *        [-MaterialSlots=<n>] [-TextureSets=<n>] [-TextureSize=<n>] [-ContentPath=/Game/<dir>]
+ *        [-Skeleton=<path>] -unattended -nullrhi
+ *
+ * The same arguments always produce the same files. Returns 0 when the corpus was written.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UAssetsBridgeCorpusCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAssetsBridgeCorpusCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
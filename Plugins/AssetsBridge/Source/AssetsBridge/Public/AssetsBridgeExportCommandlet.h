@@ -0,0 +1,42 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetsBridgeExportCommandlet.generated.h"
+
+/**
+ * Headless glTF export, used both by the parallel export workers and for bulk exports of content folders.
+ *
+ * Worker mode: UnrealEditor-Cmd <Project>.uproject -run=AssetsBridgeExport -Input=<manifest> -Output=<manifest>
+ *
+ * Loads every item of the input manifest by its model path, exports it to its ExportLocation and writes the
+ * items that were exported to the output manifest. Returns 0 when every item was exported.
+ *
+ * Bulk mode: UnrealEditor-Cmd <Project>.uproject -run=AssetsBridgeExport -Path=/Game/Props[,/Game/Chars]
+ *            [-ExportRoot=<dir>] [-BatchSize=<n>] [-ManifestShardSize=<n>] [-Resume] -unattended -nullrhi
+ *
+ * Exports every static and skeletal mesh under the given content paths, loading them in batches of BatchSize
+ * (default 200) and collecting garbage in between so memory stays bounded. Progress is written after every
+ * batch so an interrupted run continues where it stopped with -Resume. The result is from-unreal.json in the
+ * export root, or from-unreal-<n>.json files of at most ManifestShardSize items each.
+ * Returns 0 when every mesh was exported.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UAssetsBridgeExportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAssetsBridgeExportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Exports the items of a manifest written by the editor that spawned this worker. */
+	int32 RunWorker(const FString& InputFile, const FString& OutputFile);
+
+	/** Exports every mesh under the given content paths. */
+	int32 RunBulkExport(const FString& Params, const FString& ContentPaths);
+};
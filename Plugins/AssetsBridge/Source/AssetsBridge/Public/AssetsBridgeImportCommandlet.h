@@ -0,0 +1,31 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetsBridgeImportCommandlet.generated.h"
+
+/**
+ * Headless Blender -> Unreal import for build machines.
+ *
+ * Usage: UnrealEditor-Cmd <Project>.uproject -run=AssetsBridgeImport [-ExportRoot=<dir>] [-Manifest=<file>]
+ *        [-Summary=<file>] [-ShardIndex=<n> -ShardCount=<n>] [-Force] [-NoSave] -unattended -nullrhi
+ *
+ * Runs the regular import pipeline without any dialogs or notifications, saves every content package it
+ * dirtied and writes a JSON summary with per-item results and stage timings (default: import-summary.json
+ * next to the manifest).
+ *
+ * Exit codes: 0 everything imported, 1 some items failed, 2 bad arguments or unreadable manifest,
+ * 3 packages could not be saved.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UAssetsBridgeImportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAssetsBridgeImportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -170,6 +170,10 @@ struct FExportAsset
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Assets Bridge|Object Details")
 	TArray<FString> MorphTargets;
 
+	/** Morph targets that are empty on purpose (e.g. correctives still to be sculpted), kept by the import's morph pruning */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Assets Bridge|Object Details")
+	TArray<FString> KeepEmptyMorphTargets;
+
 	/** World transform data */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Assets Bridge|Object Details")
 	FWorldData WorldData = FWorldData();
@@ -218,6 +222,7 @@ public:
 
 
 class UStruct;
+class UInterchangePipelineStackOverride;
 /**
  * 
  */
@@ -227,6 +232,13 @@ class ASSETSBRIDGE_API UAssetsBridgeTools : public UBlueprintFunctionLibrary
 	GENERATED_BODY()
 
 public:
+	/**
+	 * Whether the editor runs without anyone to answer dialogs (-unattended or a commandlet).
+	 * Dialogs and notifications are skipped and only logged in that case.
+	 */
+	UFUNCTION(BlueprintPure, Category="Assets Bridge Utilities")
+	static bool IsUnattended();
+
 	/**
 	 * Creates a dialog to inform the user.
 	 * @param Message is the message to be displayed in the dialog for the user to read.
@@ -261,6 +273,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category="JSON")
 	static FBridgeExport ReadBridgeExportFile(bool& bIsSuccessful, FString& OutMessage);
 
+	/**
+	 * Reads a manifest from an explicit location instead of the export root. Either manifest format is accepted,
+	 * and a binary manifest written for the same .json path is found as well (see UBridgeManifest::ResolveReadPath).
+	 *
+	 * @param InFilePath Location of the manifest on disk.
+	 * @param bIsSuccessful Provides boolean whether operation succeeded.
+	 * @param OutMessage Provides more verbose information on the operation.
+	 *
+	 * @return Returns the manifest read from the file.
+	 */
+	UFUNCTION(BlueprintCallable, Category="JSON")
+	static FBridgeExport ReadBridgeExportFileAt(const FString& InFilePath, bool& bIsSuccessful, FString& OutMessage);
+
 	/**
 		 * Writes a JSON file from a Array of FBridgeExportElement Structure.
 		 *
@@ -271,6 +296,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category="JSON")
 	static void WriteBridgeExportFile(FBridgeExport Data, bool& bIsSuccessful, FString& OutMessage);
 
+	/**
+	 * Writes a manifest to an explicit location in the configured manifest format. Binary manifests are
+	 * written with UBridgeManifest::BinaryExtension in place of the extension of JsonFilePath.
+	 *
+	 * @param Data Contains the data that is to be converted over.
+	 * @param JsonFilePath Location of the manifest on disk.
+	 * @param bIsSuccessful Provides boolean whether operation succeeded.
+	 * @param OutMessage Provides more verbose information on the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="JSON")
+	static void WriteBridgeExportFileAt(const FBridgeExport& Data, const FString& JsonFilePath, bool& bIsSuccessful, FString& OutMessage);
+
 
 	/**
 	 * This is a utility function to find the currently selected item(s) and select them in the content browser.
@@ -365,6 +402,36 @@ public:
 	 */
 	static TSharedPtr<FJsonObject> ReadJson(FString FilePath, bool& bIsSuccessful, FString& OutMessage);
 
+	/**
+	 * Reads the JSON document of a glTF file, i.e. the JSON chunk of a binary .glb or the whole of a .gltf,
+	 * without touching the binary buffers.
+	 *
+	 * @param FilePath	Location of the .glb / .gltf file on disk.
+	 * @param bIsSuccessful Returns true of operation is successful.
+	 * @param OutMessage Verbose information on the current operation.
+	 *
+	 * @return The root glTF object.
+	 */
+	static TSharedPtr<FJsonObject> ReadGltfJson(const FString& FilePath, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * The pipelines of the project's default Interchange import stack for a file, i.e. the stack configured in
+	 * the Interchange project settings for its translator, with the translator specific list when there is one.
+	 * Meant to seed a UInterchangePipelineStackOverride so an import keeps the project settings. Empty when the
+	 * project has no Interchange stack for the file.
+	 *
+	 * @param FilePath	Location of the file to import.
+	 */
+	static TArray<FSoftObjectPath> GetProjectImportPipelines(const FString& FilePath);
+
+	/**
+	 * The loaded pipelines of an import stack override. The stack only names its pipelines by path, which does
+	 * not keep transient ones alive, so callers hold on to these for the duration of the import.
+	 *
+	 * @param Stack	The stack override set as the Options of an import task.
+	 */
+	static TArray<UObject*> GetStackPipelines(const UInterchangePipelineStackOverride* Stack);
+
 	/**
 	* Open a json file read it's content and convert it to a json object
 	*
@@ -398,6 +465,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Assets Bridge Settings")
 	static void SetExportRoot(FString InLocation);
 
+	/**
+	* Applies a commandlet's -ExportRoot=<dir> argument for this process only, without saving it to the config.
+	*
+	* @param Params The commandlet parameters.
+	* @return The export root in effect, the configured one when the argument is absent.
+	*/
+	static FString ApplyExportRootOverride(const FString& Params);
+
 	/**
 	* Opens a folder browser dialog to select the export root location.
 	* If a folder is selected, it is saved as the new export root.
@@ -0,0 +1,98 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetsBridgeTools.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "BridgeCorpusGenerator.generated.h"
+
+/** Shape of a synthetic corpus; the same options and seed always produce the same files */
+USTRUCT(BlueprintType)
+struct FBridgeCorpusOptions
+{
+	GENERATED_BODY()
+
+	/** Directory that receives from-blender.json and the generated files (the export root for an import) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge")
+	FString OutputDir;
+
+	/** Content folder the manifest imports into */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge")
+	FString ContentPath = "/Game/BridgeCorpus";
+
+	/** Seed of the random stream every generated value is drawn from */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge")
+	int32 Seed = 1;
+
+	/** Number of static mesh items */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "0"))
+	int32 StaticMeshes = 100;
+
+	/** Number of skeletal mesh items */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "0"))
+	int32 SkeletalMeshes = 10;
+
+	/** Approximate triangle count of every generated mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "2"))
+	int32 Triangles = 2000;
+
+	/** Depth of the bone chain of every skeletal mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "1"))
+	int32 Bones = 64;
+
+	/** Morph targets per skeletal mesh; one in eight is empty and one in eight negligible, to exercise morph pruning */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "0"))
+	int32 MorphTargets = 16;
+
+	/** Upper bound of material slots per mesh; each slot is randomly unchanged or added, and some meshes also remove one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "1"))
+	int32 MaxMaterialSlots = 3;
+
+	/** Number of items (spread over both mesh kinds) that get a baked texture set */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "0"))
+	int32 TextureSets = 10;
+
+	/** Width and height of the baked textures */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "4"))
+	int32 TextureSize = 1024;
+
+	/** Skeleton every skeletal mesh refers to; empty uses the skeleton generated for the first skeletal mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge")
+	FString SkeletonPath;
+};
+
+/**
+ * Generates synthetic bridge corpora for benchmarks and soak tests: a from-blender.json with the requested
+ * number of items, a .glb per item (tessellated strips, bone chains with skin weights, banded morph targets
+ * named through extras.targetNames), material changesets and baked PNG texture sets. Editor-only.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UBridgeCorpusGenerator : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Writes a corpus to Options.OutputDir. The manifest uses the configured manifest format.
+	 *
+	 * @param Options Size and shape of the corpus.
+	 * @param bIsSuccessful Returns false when a file could not be written.
+	 * @param OutMessage Verbose information on the current operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Assets Bridge Tools")
+	static void GenerateCorpus(const FBridgeCorpusOptions& Options, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Builds a binary glTF of a tessellated vertical strip.
+	 *
+	 * @param Stream Random stream for vertex jitter and morph shapes.
+	 * @param Triangles Approximate triangle count.
+	 * @param Bones Length of the bone chain the strip is skinned to, 0 for a static mesh.
+	 * @param MorphTargets Number of morph targets, only used for skinned meshes.
+	 * @param MaterialNames One primitive is written per material, each covering a band of the strip.
+	 * @param OutBytes Receives the .glb file contents.
+	 */
+	static void BuildStripGlb(FRandomStream& Stream, int32 Triangles, int32 Bones, int32 MorphTargets,
+	                          const TArray<FString>& MaterialNames, TArray<uint8>& OutBytes);
+};
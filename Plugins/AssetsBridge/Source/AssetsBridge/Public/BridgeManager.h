@@ -3,6 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AssetsBridgeTools.h"
+#include "BridgeStats.h"
+#include "PBRMaterialBuilder.h"
 #include "BridgeManager.generated.h"
 
 class UAssetImportTask;
@@ -10,6 +13,8 @@ class UFactory;
 class USkeleton;
 class USkeletalMesh;
 class UPhysicsAsset;
+struct FReferenceSkeleton;
+struct FStreamableHandle;
 
 /** Result of post-import skeleton analysis */
 USTRUCT(BlueprintType)
@@ -42,6 +47,143 @@ struct FSkeletonImportResult
 	USkeletalMesh* ImportedMesh = nullptr;
 };
 
+/** Options controlling a single import run */
+USTRUCT(BlueprintType)
+struct FBridgeImportOptions
+{
+	GENERATED_BODY()
+
+	/** Reimport every item even when its source files are unchanged since the last import */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge")
+	bool bForceReimport = false;
+
+	/** Manifest to import instead of from-blender.json in the export root */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge")
+	FString ManifestPath;
+
+	/** Split the manifest into ShardCount parts and only import the items of part ShardIndex (manifest index % ShardCount) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "0"))
+	int32 ShardIndex = 0;
+
+	/** Number of parts the manifest is split into, 1 imports everything */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AssetsBridge", meta = (ClampMin = "1"))
+	int32 ShardCount = 1;
+};
+
+/** Per-item outcome of an import run */
+USTRUCT(BlueprintType)
+struct FBridgeImportItemResult
+{
+	GENERATED_BODY()
+
+	/** Source file on disk the item was imported from */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString SourceFile;
+
+	/** Package the item was imported into */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString PackageName;
+
+	/** Whether the item was imported successfully */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	bool bIsSuccessful = false;
+
+	/** Whether the import was skipped because the source was unchanged */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	bool bSkipped = false;
+
+	/** Verbose status for this item */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	FString Message;
+
+	/** Baked textures of this item that reused an existing texture with identical content */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	int32 TexturesDeduplicated = 0;
+
+	/** Size of the PNGs that did not have to be imported because of deduplication */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	int64 TextureBytesSaved = 0;
+
+	/** Morph targets removed from this item because none of their deltas exceeded the prune threshold */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	int32 MorphTargetsPruned = 0;
+
+	/** Morph delta memory freed by pruning, both removed targets and stripped vertex deltas */
+	UPROPERTY(BlueprintReadOnly, Category = "AssetsBridge")
+	int64 MorphBytesSaved = 0;
+};
+
+/** What UBridgeManager::PruneSourceMorphTargets did to a mesh */
+struct FBridgeMorphPruneResult
+{
+	/** Morph targets the mesh had before pruning */
+	int32 NumMorphTargets = 0;
+
+	/** Morph targets removed because none of their deltas exceeded the threshold */
+	int32 NumRemoved = 0;
+
+	/** Negligible vertex deltas zeroed in the kept and removed morph targets */
+	int32 NumStripped = 0;
+
+	/** Built morph delta memory freed, estimated from the stripped source deltas */
+	int64 BytesSaved = 0;
+
+	FString ToString(const FString& MeshName) const;
+};
+
+/** Working state for a single manifest item while it moves through the import pipeline */
+struct FBridgeImportJob
+{
+	/** The manifest entry being imported */
+	FExportAsset Item;
+
+	/** Asset name recovered from the manifest model path */
+	FString OriginalName;
+
+	/** Sanitized destination package for the asset */
+	FString ImportPackageName;
+
+	/** Source stamp and content hash recorded on the asset once imported (see SourceFingerprintTag) */
+	FString SourceFingerprint;
+
+	/** Import task submitted to AssetTools (null if the task could not be created) */
+	TObjectPtr<UAssetImportTask> Task = nullptr;
+
+	/** Primary asset produced by the import (after relocation once finalized) */
+	TObjectPtr<UObject> ImportedAsset = nullptr;
+
+	/** Pipelines the task's stack override names by path, held here so the transient ones outlive a GC until the import ran */
+	TArray<TObjectPtr<UObject>> TaskPipelines;
+
+	/** Existing skeleton with a compatible bone hierarchy, found by ResolveJobSkeletons when the manifest names none */
+	FString MatchedSkeletonPath;
+
+	/** Baked textures imported for the whole run by ImportJobTextures, valid when bTexturesImported */
+	FPBRTextureSetTextures Textures;
+	bool bTexturesImported = false;
+
+	/** Reported outcome */
+	FBridgeImportItemResult Result;
+};
+
+/** Baked texture imports of a run, from UBridgeManager::SubmitJobTextures until ResolveJobTextures */
+struct FBridgeJobTextures
+{
+	TArray<FPBRTextureImport> Requests;
+
+	/** Per job, the index of its first request (INDEX_NONE without textures) and its number of requests */
+	TArray<int32> FirstRequests;
+	TArray<int32> NumRequests;
+
+	FPBRTextureImportBatch Batch;
+
+	bool bResolved = false;
+};
+
+/** Fired on the game thread once an asynchronous import has finished all of its post-import steps */
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnBridgeImportComplete, bool, bIsSuccessful, const FString&, OutMessage,
+                                     const TArray<FBridgeImportItemResult>&, Results);
+
 /**
  * 
  */
@@ -127,6 +269,33 @@ public:
 	 */
 	static void GenerateExport(TArray<FExportAsset> AssetList, bool& bIsSuccessful, FString& OutMessage);
 
+	/**
+	 * Exports the meshes of the given items without writing a manifest: unchanged .glb files are reused
+	 * through the export cache and the rest are exported in process or by the parallel export workers.
+	 * 
+	 * @param Items the export items, with ModelPtr pointing at the loaded mesh.
+	 * @param OutExported parallel to Items, set to whether each item's .glb is up to date (exported or reused).
+	 * @param OutNumExported number of items written by this call.
+	 * @param OutNumReused number of items whose previous .glb was reused.
+	 * @param bIsSuccessful false only when a destination directory could not be created.
+	 * @param OutMessage provides verbose information on the status of the operation.
+	 */
+	static void ExportAssetsIncremental(const TArray<FExportAsset>& Items, TArray<bool>& OutExported,
+	                                    int32& OutNumExported, int32& OutNumReused, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Exports the meshes of the given items to their .glb files in this process, one after the other.
+	 * Used by GenerateExport and by the export commandlet that runs in parallel export workers.
+	 * 
+	 * @param Items the export items, with ModelPtr pointing at the loaded mesh.
+	 * @param ItemIndices which of the items to export.
+	 * @param OutExported parallel to Items, set to whether each exported item was written.
+	 * @param bIsSuccessful false only when a destination directory could not be created.
+	 * @param OutMessage provides verbose information on the status of the operation.
+	 */
+	static void ExportAssetItems(const TArray<FExportAsset>& Items, const TArray<int32>& ItemIndices, TArray<bool>& OutExported,
+	                             bool& bIsSuccessful, FString& OutMessage);
+
 	/**
 	 * This function is responsible for reading the manifest and importing the associated mesh in level or multiple meshes to asset library.
 	 * 
@@ -136,6 +305,56 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Assets Bridge Exports")
 	static void GenerateImport(bool& bIsSuccessful, FString& OutMessage);
 
+	/**
+	 * Same as GenerateImport with explicit options, e.g. to force a reimport of unchanged items.
+	 * 
+	 * @param Options controls how the manifest is imported.
+	 * @param bIsSuccessful indicates whether operation was successful
+	 * @param OutMessage provides verbose information on the status of the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Assets Bridge Exports")
+	static void GenerateImportWithOptions(const FBridgeImportOptions& Options, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Same as GenerateImportWithOptions and also returns the outcome of every item. Fails without importing
+	 * anything while an asynchronous import is in progress.
+	 * 
+	 * @param Options controls how the manifest is imported.
+	 * @param OutResults receives one result per imported manifest item.
+	 * @param bIsSuccessful indicates whether operation was successful
+	 * @param OutMessage provides verbose information on the status of the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Assets Bridge Exports")
+	static void GenerateImportWithResults(const FBridgeImportOptions& Options, TArray<FBridgeImportItemResult>& OutResults,
+	                                      bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Starts an import of the manifest without blocking the editor. Mesh and baked texture import tasks run
+	 * asynchronously and the post-import steps for each item run on the game thread as it completes, with
+	 * progress shown as a notification.
+	 * 
+	 * @param Options controls how the manifest is imported.
+	 * @param OnComplete called once every item has been processed.
+	 * @param bIsSuccessful indicates whether the import was started
+	 * @param OutMessage provides verbose information on the status of the operation.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Assets Bridge Exports")
+	static void GenerateImportAsync(const FBridgeImportOptions& Options, const FOnBridgeImportComplete& OnComplete,
+	                                bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Whether an asynchronous import started by GenerateImportAsync is still running.
+	 */
+	UFUNCTION(BlueprintPure, Category="Assets Bridge Exports")
+	static bool IsImportInProgress();
+
+	/**
+	 * Per-stage timings of the last finished import or export, e.g. to print with FBridgeOperationStats::ToString.
+	 * For asynchronous imports the stats are complete by the time OnComplete is called.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Assets Bridge Exports")
+	static FBridgeOperationStats GetLastOperationStats();
+
 	/**
 	 * This function provides a means to replace the current references of an old packages to reference the new package instead.
 	 */
@@ -169,6 +388,82 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Asset Bridge Tools")
 	static void RetargetSkeletalMeshToSkeleton(const FSkeletonImportResult& InImportResult, bool bDeleteGeneratedAssets, bool& bIsSuccessful, FString& OutMessage);
 
+	/**
+	 * Retargets many skeletal meshes at once, e.g. the parts of a modular character. Meshes are grouped by
+	 * target skeleton: each skeleton is loaded and marked dirty once, meshes that need a rebuild are rebuilt
+	 * together by the skinned asset compiler, and every generated skeleton and physics asset is removed with
+	 * a single delete.
+	 * @param InImportResults Analysis results from AnalyzeSkeletalMeshImport
+	 * @param bDeleteGeneratedAssets If true, deletes the auto-generated skeletons and physics assets
+	 * @param bIsSuccessful Output: whether every mesh was retargeted
+	 * @param OutMessage Output: verbose status message
+	 */
+	UFUNCTION(BlueprintCallable, Category="Asset Bridge Tools")
+	static void RetargetSkeletalMeshesToSkeleton(const TArray<FSkeletonImportResult>& InImportResults, bool bDeleteGeneratedAssets, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Whether a mesh can be bound to a skeleton by only reassigning it: every bone of the mesh exists in the
+	 * target with the same parent, which is what the fast retarget path requires.
+	 * @param MeshRefSkeleton Reference skeleton of the mesh
+	 * @param TargetRefSkeleton Reference skeleton of the target skeleton
+	 * @param bOutBonesFound Output: false when a mesh bone is missing from the target altogether
+	 */
+	static bool IsHierarchyCompatible(const FReferenceSkeleton& MeshRefSkeleton, const FReferenceSkeleton& TargetRefSkeleton, bool& bOutBonesFound);
+
+	/**
+	 * Renames many morph targets of a mesh in one pass, without transactions, redirectors or per-morph logging.
+	 * Names swapped between two morphs go through temporary names, and the mesh's morph target lookup is
+	 * rebuilt once at the end. The source mesh descriptions are renamed too, so a rebuild keeps the names.
+	 * @param InMesh The mesh whose morph targets are renamed
+	 * @param InNewNames Current morph target name -> new name; morphs not listed keep their name
+	 * @param OutNumRenamed Number of morph targets renamed
+	 * @param bIsSuccessful Output: false when a rename was skipped because a morph that keeps its name has it
+	 * @param OutMessage Output: verbose status message
+	 */
+	UFUNCTION(BlueprintCallable, Category="Asset Bridge Tools")
+	static void RenameMorphTargets(USkeletalMesh* InMesh, const TMap<FName, FName>& InNewNames, int32& OutNumRenamed, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Maps the imported morph targets of a mesh to manifest names by key rather than by position: an imported
+	 * name that is a manifest name (as is or sanitized), else the glTF target name (mesh extras.targetNames) it
+	 * was imported as. Only files without recorded names fall back to manifest order. Names that only differ
+	 * in case collide, since morph target names are case-insensitive; the first is kept and the collision logged.
+	 * @param InMesh The imported mesh
+	 * @param InManifestNames Original morph target names from FExportAsset::MorphTargets
+	 * @param InGltfTargetNames Shape key names from the source file, in glTF target order
+	 * @return Imported morph target name -> manifest name, for RenameMorphTargets
+	 */
+	static TMap<FName, FName> BuildMorphTargetRenames(const USkeletalMesh* InMesh, const TArray<FString>& InManifestNames,
+	                                                 const TArray<FString>& InGltfTargetNames);
+
+	/**
+	 * Strips the vertex deltas whose position moves less than InThreshold and whose normal barely changes from
+	 * every morph target in the mesh's source mesh descriptions, then removes the morph targets left without
+	 * deltas, except those named in InKeepNames. Only commits the mesh descriptions; the caller builds the mesh,
+	 * which on import is the build that follows UBridgeMorphPrunePipeline.
+	 * @param InMesh The mesh to prune
+	 * @param InThreshold Position delta length (cm) below which a vertex delta is negligible
+	 * @param InKeepNames Morph targets to keep even when empty, e.g. FExportAsset::KeepEmptyMorphTargets
+	 * @param OutResult What was pruned
+	 * @return Whether any mesh description changed
+	 */
+	static bool PruneSourceMorphTargets(USkeletalMesh* InMesh, float InThreshold, const TArray<FString>& InKeepNames,
+	                                    FBridgeMorphPruneResult& OutResult);
+
+	/**
+	 * Prunes the morph targets of an already imported mesh with PruneSourceMorphTargets and rebuilds it once.
+	 * @param InMesh The mesh to prune
+	 * @param InThreshold Position delta length (cm) below which a vertex delta is negligible
+	 * @param InKeepNames Morph targets to keep even when empty
+	 * @param OutNumRemoved Number of morph targets removed
+	 * @param OutBytesSaved Built morph delta memory freed, estimated from the stripped source deltas
+	 * @param bIsSuccessful Output: whether the operation succeeded
+	 * @param OutMessage Output: verbose status message
+	 */
+	UFUNCTION(BlueprintCallable, Category="Asset Bridge Tools")
+	static void PruneMorphTargets(USkeletalMesh* InMesh, float InThreshold, const TArray<FString>& InKeepNames, int32& OutNumRemoved,
+	                              int64& OutBytesSaved, bool& bIsSuccessful, FString& OutMessage);
+
 	/**
 	 * Shows a dialog asking the user if they want to retarget the mesh to the intended skeleton.
 	 * @param InImportResult The analysis result showing what was auto-generated
@@ -179,6 +474,124 @@ public:
 
 private:
 	static UObject* ProcessTask(UAssetImportTask* ImportTask, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Picks the primary asset out of a completed import task (meshes preferred over skeleton/physics assets).
+	 */
+	static UObject* ResolveImportTask(UAssetImportTask* ImportTask, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Reads the manifest selected by the options and keeps only the items of the requested shard.
+	 */
+	static FBridgeExport ReadImportManifest(const FBridgeImportOptions& Options, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Resolves the destination package for a manifest item and creates its import task. Items whose source
+	 * fingerprint matches the one recorded on the existing asset are marked skipped and get no task.
+	 * Failures are recorded on the job result rather than aborting the run.
+	 */
+	static void PrepareImportJob(const FExportAsset& InItem, const FBridgeImportOptions& Options, FBridgeImportJob& OutJob);
+
+	/**
+	 * Returns true when the asset already at the job's destination was imported from identical source files,
+	 * computing OutJob.SourceFingerprint along the way.
+	 */
+	static bool IsImportUpToDate(FBridgeImportJob& Job);
+
+	/** Asset metadata tag holding the source fingerprint of the last import, searchable in the asset registry */
+	static const FName SourceFingerprintTag;
+
+	/** Exposes SourceFingerprintTag in the asset registry of saved packages; called on module startup. */
+	static void RegisterAssetRegistryTags();
+
+	/**
+	 * Submits the prepared import tasks in chunks of InBatchSize per ImportAssetTasks call (0 = all at once)
+	 * and resolves the primary imported asset of each job. Async submissions are resolved later by TickAsyncImport.
+	 */
+	static void SubmitImportJobs(TArray<FBridgeImportJob>& Jobs, int32 InBatchSize, bool bInAsync = false);
+
+	/**
+	 * Polls the running asynchronous import, finalizing completed items within a small per-frame budget.
+	 * @return false once the import has finished and the ticker should be removed.
+	 */
+	static bool TickAsyncImport(float DeltaTime);
+
+	/**
+	 * Runs the post-import steps (relocation, morph target names, materials) for a job.
+	 */
+	static void FinalizeImportJob(FBridgeImportJob& Job);
+
+	/**
+	 * Imports the baked textures of every imported job that has a texture set with one batched texture
+	 * import, so FinalizeImportJob only has to build the material instances. Failed jobs are skipped.
+	 */
+	static void ImportJobTextures(TArray<FBridgeImportJob>& Jobs, int32 InBatchSize);
+
+	/**
+	 * Submits the texture imports of ImportJobTextures. Async runs submit them with bInAsync before the mesh
+	 * tasks, for every job that has a task, and resolve them from TickAsyncImport once they completed.
+	 */
+	static void SubmitJobTextures(const TArray<FBridgeImportJob>& Jobs, int32 InBatchSize, bool bInAsync, FBridgeJobTextures& OutTextures);
+
+	/** Hands the textures submitted by SubmitJobTextures to their jobs, once Textures.Batch.IsImportComplete(). */
+	static void ResolveJobTextures(TArray<FBridgeImportJob>& Jobs, FBridgeJobTextures& Textures);
+
+	/**
+	 * Starts one async load of every material FinalizeImportJob will restore from the jobs' unchanged
+	 * material slots, so the loads overlap with the mesh imports instead of blocking per slot afterwards.
+	 * Returns null when there is nothing to load.
+	 */
+	static TSharedPtr<FStreamableHandle> PreloadRestoredMaterials(const TArray<FBridgeImportJob>& Jobs);
+
+	/**
+	 * Looks up a compatible existing skeleton for every skeletal job CreateImportTask could not point at a
+	 * skeleton (no usable manifest skeleton and no existing mesh), by reading the joints of its glTF file and
+	 * querying FBridgeSkeletonIndex, and configures the job's import pipeline to use it. Then appends a
+	 * UBridgeMorphPrunePipeline to the skeletal jobs with morph targets when pruning is enabled, and fills every
+	 * job's TaskPipelines once the tasks are final.
+	 */
+	static void ResolveJobSkeletons(TArray<FBridgeImportJob>& Jobs);
+
+	/**
+	 * Binds the finalized meshes that got a generated skeleton to the skeleton ResolveJobSkeletons matched,
+	 * in one RetargetSkeletalMeshesToSkeleton batch, then refreshes the index tags of the skeletons the import
+	 * created and of already tagged ones. Existing untagged skeletons are left alone, see TagUntaggedSkeletons.
+	 */
+	static void RetargetMatchedSkeletons(const TArray<FBridgeImportJob>& Jobs);
+
+	/**
+	 * Builds the overall status and message for a finished import run from the per-item results.
+	 */
+	static void SummarizeImportJobs(const TArray<FBridgeImportJob>& Jobs, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Returns the glTF exporter class for static or skeletal meshes, or nullptr when the glTF Exporter plugin is not loaded.
+	 * The classes are looked up once per session and looked up again after any module is loaded or unloaded.
+	 */
+	static UClass* GetGLTFExporterClass(bool bSkeletalMesh);
+
+	/**
+	 * Splits the items across NumWorkers headless editor processes running the AssetsBridgeExport commandlet
+	 * and waits for them. Items a worker did not write are left false in OutExported for the caller to retry.
+	 * Cancelling the progress dialog stops the workers.
+	 */
+	static void ExportAssetItemsInWorkers(const TArray<FExportAsset>& Items, const TArray<int32>& ItemIndices, int32 NumWorkers,
+	                                      TArray<bool>& OutExported);
+
+	/**
+	 * Clears stale material overrides on every editor world component that uses a mesh imported by the given jobs.
+	 * The level is walked once for the whole run rather than once per imported mesh.
+	 */
+	static void RefreshWorldMeshUsers(const TArray<FBridgeImportJob>& Jobs);
+	/**
+	 * Gives a skeletal import task the project's Interchange import stack with its generic assets pipeline set to
+	 * import onto an existing skeleton and reuse the physics asset of the mesh being replaced, instead of
+	 * generating both and deleting them afterwards. Every other project pipeline and setting is kept.
+	 * A physics asset is only generated when the mesh has none and bAllowPhysicsAssetCreation is set.
+	 * Returns false, leaving the task untouched, when the skeleton cannot be loaded.
+	 */
+	static bool ConfigureSkeletalImportPipeline(UAssetImportTask* Task, const FString& InSkeletonPath, const USkeletalMesh* ExistingMesh,
+	                                            bool bAllowPhysicsAssetCreation);
 	static UAssetImportTask* CreateImportTask(FString InSourcePath, FString InDestPath, FString InMeshType,
 	                                          FString InSkeletonPath, bool& bIsSuccessful, FString& OutMessage);
 	static void ExportObject(FString InObjInternalPath, FString InDestPath, bool& bIsSuccessful, FString& OutMessage);
@@ -0,0 +1,89 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetsBridgeTools.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "BridgeManifest.generated.h"
+
+/**
+ * Reads and writes the bridge manifests (from-blender.json / from-unreal.json) without going
+ * through an intermediate FJsonObject tree, in either the JSON or the compact binary format.
+ * Binary manifests use the BinaryExtension in place of .json so JSON readers never pick them up. Editor-only.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UBridgeManifest : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Pull-parses a UTF-8 JSON manifest straight into FBridgeExport using a token loop.
+	 * Keys are matched case-insensitively like FJsonObjectConverter, and unknown keys are skipped.
+	 *
+	 * @param Utf8Data The manifest text, without a byte order mark.
+	 * @param OutData Receives the parsed manifest.
+	 * @param bIsSuccessful Returns false on malformed JSON or on a value of an unexpected type.
+	 * @param OutMessage Verbose information on the current operation.
+	 */
+	static void ParseJson(FUtf8StringView Utf8Data, FBridgeExport& OutData, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Loads a manifest file as raw bytes and parses it with ParseBinary when it starts with BinaryMagic,
+	 * otherwise as UTF-8 JSON with ParseJson.
+	 *
+	 * @param FilePath Location of the manifest on disk.
+	 * @param OutData Receives the parsed manifest.
+	 * @param bIsSuccessful Returns true if the file was read and parsed.
+	 * @param OutMessage Verbose information on the current operation.
+	 */
+	static void ReadFile(const FString& FilePath, FBridgeExport& OutData, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Returns true when the buffer holds a binary manifest.
+	 */
+	static bool IsBinary(TConstArrayView<uint8> Data);
+
+	/** Location of the manifest at FilePath in the given format, e.g. from-unreal.json -> from-unreal.abmf. */
+	static FString GetFormatPath(const FString& FilePath, bool bBinary);
+
+	/**
+	 * Returns the manifest to read for FilePath: the file itself or its other-format sibling, whichever
+	 * exists, and the newer of the two when both do.
+	 */
+	static FString ResolveReadPath(const FString& FilePath);
+
+	/**
+	 * Decodes a binary manifest.
+	 *
+	 * Layout (all integers little-endian):
+	 *   "ABMF" magic, uint32 version,
+	 *   uint32 string count, then per string a uint32 byte length followed by UTF-8 bytes,
+	 *   the FBridgeExport body, where every string field is a uint32 index into the string table,
+	 *   arrays are a uint32 count followed by their elements and vectors are three doubles.
+	 *
+	 * @param Data The complete file contents.
+	 * @param OutData Receives the parsed manifest.
+	 * @param bIsSuccessful Returns false for a truncated or corrupt file or an unknown version.
+	 * @param OutMessage Verbose information on the current operation.
+	 */
+	static void ParseBinary(TConstArrayView<uint8> Data, FBridgeExport& OutData, bool& bIsSuccessful, FString& OutMessage);
+
+	/**
+	 * Encodes a manifest with the binary layout described on ParseBinary.
+	 *
+	 * @param Data The manifest to encode.
+	 * @param OutBytes Receives the encoded file contents.
+	 */
+	static void WriteBinary(const FBridgeExport& Data, TArray<uint8>& OutBytes);
+
+	/** First four bytes of every binary manifest. */
+	static constexpr uint32 BinaryMagic = 'A' | ('B' << 8) | ('M' << 16) | ('F' << 24);
+
+	/** File extension of binary manifests, without the dot. */
+	static constexpr const TCHAR* BinaryExtension = TEXT("abmf");
+
+	/** Bumped whenever the binary layout changes; older versions are rejected rather than misread. */
+	static constexpr uint32 BinaryVersion = 2;
+};
@@ -0,0 +1,41 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InterchangePipelineBase.h"
+#include "BridgeMorphPrunePipeline.generated.h"
+
+struct FBridgeMorphPruneResult;
+
+/**
+ * Interchange pipeline that prunes the morph targets of an imported skeletal mesh in its mesh descriptions
+ * once the factory created it and before it is first built (see UBridgeManager::PruneSourceMorphTargets),
+ * so negligible deltas and empty morph targets never cost a build. Runs after the generic assets pipeline.
+ */
+UCLASS(BlueprintType, EditInlineNew)
+class ASSETSBRIDGE_API UBridgeMorphPrunePipeline : public UInterchangePipelineBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Vertex position deltas shorter than this (in cm) are negligible. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Morph Targets", meta = (ClampMin = "0.0", Units = "cm"))
+	float Threshold = 0.01f;
+
+	/** Morph targets kept even when they move nothing, e.g. FExportAsset::KeepEmptyMorphTargets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Morph Targets")
+	TArray<FString> KeepNames;
+
+	/**
+	 * Returns what a pipeline pruned on the mesh and forgets it. Interchange runs copies of the pipelines,
+	 * so the results are kept per mesh rather than on the pipeline the import task was given.
+	 */
+	static bool TakePruneResult(const UObject* Mesh, FBridgeMorphPruneResult& OutResult);
+
+protected:
+	virtual void ExecutePostFactoryPipeline(const UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& FactoryNodeKey,
+	                                        UObject* CreatedAsset, bool bIsAReimport) override;
+
+	virtual bool CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask) override;
+};
@@ -0,0 +1,113 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "BridgeSkeletonIndex.generated.h"
+
+class USkeleton;
+class FJsonObject;
+
+/** A bone and its parent (NAME_None for a root), the unit skeletons are compared by */
+struct FBridgeBoneLink
+{
+	FName Bone;
+	FName Parent;
+};
+
+/**
+ * Lookup of the project's skeletons by bone hierarchy, built from asset registry tags only so no
+ * skeleton has to be loaded. Build one per import run; skeletons tagged afterwards are not seen.
+ */
+class ASSETSBRIDGE_API FBridgeSkeletonIndex
+{
+public:
+	/** Reads the hierarchy tags of every skeleton known to the asset registry. */
+	static FBridgeSkeletonIndex Build();
+
+	/**
+	 * Returns a skeleton with exactly this hierarchy, else the smallest skeleton that contains every bone
+	 * with the same parent (roots may sit anywhere). Returns an empty path when none is compatible.
+	 */
+	FSoftObjectPath FindCompatible(const TArray<FBridgeBoneLink>& Bones) const;
+
+	/** Indexes a skeleton by its bone hierarchy; Build adds every tagged skeleton of the project this way. */
+	void Add(const FSoftObjectPath& Path, const TArray<FBridgeBoneLink>& Bones);
+
+	/** Number of indexed skeletons. */
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	void Add(const FSoftObjectPath& Path, const TArray<FBridgeBoneLink>& Bones, const FString& Fingerprint);
+
+	struct FEntry
+	{
+		FSoftObjectPath Path;
+		TMap<FName, FName> Parents;
+	};
+
+	TArray<FEntry> Entries;
+
+	/** Fingerprint -> entry, for the exact match */
+	TMap<FString, int32> ByFingerprint;
+
+	/** Bone name -> entries containing it, narrows the subset search to skeletons sharing the mesh's root */
+	TMultiMap<FName, int32> ByBone;
+};
+
+/**
+ * Fingerprints skeleton bone hierarchies and records them as asset registry searchable metadata tags,
+ * so imports can find a compatible skeleton through FBridgeSkeletonIndex. Editor-only.
+ */
+UCLASS()
+class ASSETSBRIDGE_API UBridgeSkeletonIndex : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Metadata tag holding the hierarchy fingerprint */
+	static const FName FingerprintTag;
+
+	/** Metadata tag holding the sorted "bone>parent" list the subset match reads */
+	static const FName HierarchyTag;
+
+	/** Exposes the tags in the asset registry of saved packages; called on module startup. */
+	static void RegisterAssetRegistryTags();
+
+	/** Order independent hash of the bone names and their parents. */
+	static FString ComputeFingerprint(const TArray<FBridgeBoneLink>& Bones);
+
+	/** Bone hierarchy of a loaded skeleton. */
+	static TArray<FBridgeBoneLink> GetSkeletonBones(const USkeleton* Skeleton);
+
+	/**
+	 * Reads the joints of the skins in a glTF file (its JSON only, no buffers) with their parent joints.
+	 *
+	 * @param FilePath Location of the .glb / .gltf on disk.
+	 * @param OutBones Receives the joints; empty for a file without skins.
+	 * @param bIsSuccessful Returns false when the file could not be read.
+	 * @param OutMessage Verbose information on the current operation.
+	 */
+	static void ReadGltfBones(const FString& FilePath, TArray<FBridgeBoneLink>& OutBones, bool& bIsSuccessful, FString& OutMessage);
+
+	/** Same as above from an already parsed glTF document. */
+	static TArray<FBridgeBoneLink> ReadGltfBones(const TSharedPtr<FJsonObject>& Gltf);
+
+	/**
+	 * Writes the fingerprint tags on a skeleton when they are missing or stale and marks it dirty.
+	 * Returns true when the tags changed.
+	 */
+	static bool TagSkeleton(USkeleton* Skeleton);
+
+	/**
+	 * Loads every skeleton in the project that has no fingerprint tag yet and tags it, so existing
+	 * skeletons become visible to the index once they are saved.
+	 *
+	 * @param bIsSuccessful Returns true if operation is successful.
+	 * @param OutMessage Verbose information on the current operation.
+	 * @return Number of skeletons tagged.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AssetsBridge")
+	static int32 TagUntaggedSkeletons(bool& bIsSuccessful, FString& OutMessage);
+};
@@ -0,0 +1,111 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+#include "BridgeStats.generated.h"
+
+/** Trace channel for the bridge pipeline stages. Enable with -trace=cpu,AssetsBridge to see them in Insights. */
+UE_TRACE_CHANNEL_EXTERN(AssetsBridgeChannel, ASSETSBRIDGE_API);
+
+USTRUCT(BlueprintType)
+struct FBridgeStageStats
+{
+	GENERATED_BODY()
+
+	/** Name of the pipeline stage, e.g. "Import Task" or "Material Instance". */
+	UPROPERTY(BlueprintReadOnly, Category="Assets Bridge|Stats")
+	FString Stage = "";
+
+	/** How many times the stage ran during the operation. */
+	UPROPERTY(BlueprintReadOnly, Category="Assets Bridge|Stats")
+	int32 Count = 0;
+
+	/** Wall time spent in the stage, summed over every run. */
+	UPROPERTY(BlueprintReadOnly, Category="Assets Bridge|Stats")
+	double Seconds = 0.0;
+};
+
+USTRUCT(BlueprintType)
+struct ASSETSBRIDGE_API FBridgeOperationStats
+{
+	GENERATED_BODY()
+
+	/** The operation that was measured, e.g. "Import" or "Export". */
+	UPROPERTY(BlueprintReadOnly, Category="Assets Bridge|Stats")
+	FString Operation = "";
+
+	/** Wall time from the start to the end of the operation. */
+	UPROPERTY(BlueprintReadOnly, Category="Assets Bridge|Stats")
+	double TotalSeconds = 0.0;
+
+	/** Per-stage timings in the order the stages first ran. Nested stages are also counted in their parent. */
+	UPROPERTY(BlueprintReadOnly, Category="Assets Bridge|Stats")
+	TArray<FBridgeStageStats> Stages;
+
+	/** Adds one run of a stage. */
+	void AddStageTime(const TCHAR* Stage, double Seconds);
+
+	/** Multi-line per-stage breakdown for logs. */
+	FString ToString() const;
+};
+
+/**
+ * Collects the stage timings of the bridge operation currently running. Operations may span several
+ * editor frames (async import), so they are started and finished explicitly; an operation started
+ * while another is running is folded into the outer one.
+ */
+class ASSETSBRIDGE_API FBridgeStats
+{
+public:
+	static void BeginOperation(const FString& Operation);
+
+	/** Finishes the running operation, logs the breakdown and makes it available from GetLastOperation. */
+	static void EndOperation();
+
+	static void AddStageTime(const TCHAR* Stage, double Seconds);
+
+	static const FBridgeOperationStats& GetLastOperation();
+};
+
+/** Times the enclosing scope as one run of a stage of the running operation. */
+class FBridgeStageTimer
+{
+public:
+	explicit FBridgeStageTimer(const TCHAR* InStage)
+		: Stage(InStage)
+		, StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FBridgeStageTimer()
+	{
+		FBridgeStats::AddStageTime(Stage, FPlatformTime::Seconds() - StartTime);
+	}
+
+private:
+	const TCHAR* Stage;
+	double StartTime;
+};
+
+/** Begins an operation for the enclosing scope, for operations that finish within one call. */
+class FBridgeOperationScope
+{
+public:
+	explicit FBridgeOperationScope(const FString& Operation)
+	{
+		FBridgeStats::BeginOperation(Operation);
+	}
+
+	~FBridgeOperationScope()
+	{
+		FBridgeStats::EndOperation();
+	}
+};
+
+/** Times the enclosing scope as a pipeline stage, both in FBridgeOperationStats and as an Insights CPU event. */
+#define BRIDGE_STAGE_SCOPE(StageName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("AssetsBridge " StageName, AssetsBridgeChannel); \
+	FBridgeStageTimer ANONYMOUS_VARIABLE(BridgeStageTimer)(TEXT(StageName))
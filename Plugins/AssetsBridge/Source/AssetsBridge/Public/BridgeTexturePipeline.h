@@ -0,0 +1,41 @@
+// Copyright 2023 Nitecon Studios LLC. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TextureDefines.h"
+#include "InterchangePipelineBase.h"
+#include "BridgeTexturePipeline.generated.h"
+
+/**
+ * Interchange pipeline that sets the colour space, compression, LOD group and virtual texture streaming
+ * of every texture factory node, so baked textures are built once with their role's settings instead of
+ * being built with the defaults and rebuilt after import. Runs after the generic assets pipeline.
+ */
+UCLASS(BlueprintType, EditInlineNew)
+class ASSETSBRIDGE_API UBridgeTexturePipeline : public UInterchangePipelineBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Whether the texture holds colour data (sRGB) or linear data such as masks and normals. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Textures")
+	bool bSRGB = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Textures")
+	TEnumAsByte<TextureCompressionSettings> CompressionSettings = TC_Default;
+
+	/** Only applied when set, otherwise the texture keeps the LOD group the generic pipeline picked. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Textures")
+	bool bOverrideLODGroup = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Textures", meta = (EditCondition = "bOverrideLODGroup"))
+	TEnumAsByte<TextureGroup> LODGroup = TEXTUREGROUP_World;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Textures")
+	bool bVirtualTextureStreaming = true;
+
+protected:
+	virtual void ExecutePipeline(UInterchangeBaseNodeContainer* BaseNodeContainer, const TArray<UInterchangeSourceData*>& SourceDatas,
+	                             const FString& ContentBasePath) override;
+};
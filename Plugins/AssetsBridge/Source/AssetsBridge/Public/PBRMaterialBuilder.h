@@ -5,10 +5,12 @@
 #include "CoreMinimal.h"
 #include "AssetsBridgeTools.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "UObject/StrongObjectPtr.h"
 #include "PBRMaterialBuilder.generated.h"
 
 class UTexture2D;
 class UMaterialInstanceConstant;
+class UAssetImportTask;
 
 /** Which master-material slot a baked texture feeds (drives sRGB / compression settings). */
 UENUM()
@@ -20,6 +22,55 @@ enum class EPBRTextureRole : uint8
 	Emissive
 };
 
+/** One baked texture to import, and the texture it produced once ImportTextures ran. */
+struct FPBRTextureImport
+{
+	FString DiskFile;
+	FString TargetContentFolder;
+	EPBRTextureRole Role = EPBRTextureRole::BaseColor;
+
+	/** The imported texture, null when the import failed. */
+	UTexture2D* Texture = nullptr;
+
+	/** Verbose status of the import. */
+	FString Message;
+
+	/** True when Texture is an existing asset with the same content rather than a new import of this file. */
+	bool bDeduplicated = false;
+
+	/** Size of the PNG that did not have to be imported because of deduplication. */
+	int64 BytesSaved = 0;
+};
+
+/**
+ * Texture import tasks submitted by UPBRMaterialBuilder::SubmitTextureImports, held until
+ * ResolveTextureImports has picked up the textures they produced.
+ */
+struct FPBRTextureImportBatch
+{
+	/** One task per distinct content and role settings */
+	TArray<UAssetImportTask*> Tasks;
+	TArray<EPBRTextureRole> TaskRoles;
+
+	/** The task serving each request, INDEX_NONE for requests reused or missing on disk */
+	TArray<int32> TaskOfRequest;
+
+	/** Keeps the tasks and their role pipelines alive until resolved; the stacks name pipelines by path only */
+	TArray<TStrongObjectPtr<UObject>> Refs;
+
+	/** True once no task is still importing asynchronously. */
+	bool IsImportComplete() const;
+};
+
+/** The imported textures of one FBridgeTextureSet; null entries keep the master defaults. */
+struct FPBRTextureSetTextures
+{
+	UTexture2D* BaseColor = nullptr;
+	UTexture2D* Orm = nullptr;
+	UTexture2D* Normal = nullptr;
+	UTexture2D* Emissive = nullptr;
+};
+
 /**
  * Imports baked PBR textures from disk and builds a Material Instance of the project
  * master material (M_ORM), wiring BaseColor / MRAO / Normal / Emissive Mask parameters.
@@ -38,9 +89,42 @@ public:
 	static UTexture2D* ImportTexture(const FString& DiskFile, const FString& TargetContentFolder,
 	                                 EPBRTextureRole Role, FString& OutMessage);
 
+	/**
+	 * Import many PNGs with as few ImportAssetTasks calls as possible: requests with the same content
+	 * (MD5 of the PNG bytes) and compatible role settings share one task, and the tasks are submitted in
+	 * chunks of BatchSize (0 submits all at once). With bDeduplicateTextures enabled, textures are imported to
+	 * the content addressed SharedTextureFolder/T_<MD5>[_role] instead of TargetContentFolder, and one that
+	 * already exists there with that MD5 in its import data is reused without importing anything.
+	 * Role settings are applied to every imported texture and each request's Texture/Message is filled in.
+	 */
+	static void ImportTextures(TArray<FPBRTextureImport>& Requests, int32 BatchSize);
+
+	/**
+	 * First half of ImportTextures: fills in the requests served by existing shared textures and submits the
+	 * import tasks for the rest, asynchronously when bAsync. Hand OutBatch to ResolveTextureImports once
+	 * OutBatch.IsImportComplete().
+	 */
+	static void SubmitTextureImports(TArray<FPBRTextureImport>& Requests, int32 BatchSize, bool bAsync,
+	                                 FPBRTextureImportBatch& OutBatch);
+
+	/** Second half of ImportTextures: applies role settings to the imported textures and fills in their requests. */
+	static void ResolveTextureImports(TArray<FPBRTextureImport>& Requests, FPBRTextureImportBatch& Batch);
+
+	/**
+	 * Append the imports a texture set needs (blank entries are skipped) and return the index of the
+	 * first appended request; ResolveTextureSet maps them back once ImportTextures ran.
+	 */
+	static int32 AddTextureSetImports(const FBridgeTextureSet& Set, const FString& FallbackContentDir,
+	                                  TArray<FPBRTextureImport>& Requests);
+
+	/** Pick the textures of a set out of the requests added by AddTextureSetImports at FirstRequest. */
+	static FPBRTextureSetTextures ResolveTextureSet(const FBridgeTextureSet& Set, const TArray<FPBRTextureImport>& Requests,
+	                                               int32 FirstRequest);
+
 	/**
 	 * Build (or update) MI_<ShortName> parented to MasterPath, importing the texture set and
 	 * setting BaseColor / MRAO / Normal / 'Emissive Mask' parameters. Returns the instance.
+	 * An existing instance that already has the parent and values is left untouched (no recompile).
 	 *
 	 * @param Set                 The baked texture set (disk paths + content paths).
 	 * @param ShortName           Asset short name used for MI naming and default texture folder.
@@ -52,4 +136,15 @@ public:
 	                                                         const FString& FallbackContentDir,
 	                                                         const FString& MasterPathOverride,
 	                                                         FString& OutMessage);
+
+	/**
+	 * Same as above with textures that were already imported, e.g. by a batched ImportTextures call
+	 * covering every item of an import run.
+	 */
+	static UMaterialInstanceConstant* BuildMaterialInstance(const FBridgeTextureSet& Set,
+	                                                         const FPBRTextureSetTextures& Textures,
+	                                                         const FString& ShortName,
+	                                                         const FString& FallbackContentDir,
+	                                                         const FString& MasterPathOverride,
+	                                                         FString& OutMessage);
 };